@@ -65,6 +65,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+uint32_t uart_send(USART_TypeDef *handle, const char *buf, size_t len);
 
 /* USER CODE END EFP */
 
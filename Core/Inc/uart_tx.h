@@ -0,0 +1,112 @@
+#ifndef UART_TX_H
+#define UART_TX_H
+
+#include "FreeRTOS.h"
+#include "event_groups.h"
+#include "semphr.h"
+#include "stm32f4xx.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 전송 완료 콜백 (ISR 컨텍스트)
+ *
+ * 링 버퍼가 모두 비워졌을 때 호출된다.
+ *
+ * @param arg 등록 시 넘긴 인자
+ * @param woken portYIELD_FROM_ISR 플래그
+ */
+typedef void (*uart_tx_done_cb_t)(void *arg, BaseType_t *woken);
+
+/**
+ * @brief UART DMA 송신 포트
+ *
+ * 송신 데이터는 링 버퍼에 복사되고, DMA가 연속 구간 단위로 UART에 밀어낸다.
+ * 링 끝에서 감기는 데이터는 DMA 완료 인터럽트에서 다음 전송으로 이어진다.
+ * 포트 정의 시 uart ~ ring_size까지 채우고 uart_tx_init()을 호출한다.
+ */
+typedef struct {
+  /* 하드웨어 (정적 설정) */
+  USART_TypeDef *uart;
+  DMA_TypeDef *dma;
+  uint32_t stream;         ///< LL_DMA_STREAM_x
+  uint32_t channel;        ///< LL_DMA_CHANNEL_x
+  IRQn_Type irqn;          ///< DMA 스트림 인터럽트
+  uint8_t *ring;           ///< 송신 링 버퍼 (CCM이 아닌 SRAM)
+  size_t ring_size;
+
+  /* 상태 */
+  volatile size_t head;    ///< 쓰기 위치 (태스크)
+  volatile size_t tail;    ///< 읽기 위치 (DMA 완료 인터럽트)
+  volatile size_t dma_len; ///< 전송 중인 바이트 수 (0: 유휴)
+
+  SemaphoreHandle_t lock;  ///< 송신자 간 순서 보장
+  EventGroupHandle_t done_evt; ///< DMA 구간 완료 (대기 태스크 모두 깨움)
+
+  uart_tx_done_cb_t done_cb;
+  void *done_arg;
+} uart_tx_t;
+
+/**
+ * @brief DMA 송신 포트 초기화
+ *
+ * DMA 스트림(메모리 -> 주변장치, normal 모드)과 USART DMAT를 설정한다.
+ * USART 자체 초기화는 호출 전에 끝나 있어야 한다.
+ *
+ * @param tx 송신 포트
+ * @return int 0: 성공, -1: 실패
+ */
+int uart_tx_init(uart_tx_t *tx);
+
+/**
+ * @brief 비동기 송신
+ *
+ * 링 버퍼에 복사한 뒤 바로 반환한다. 공간이 모자라면 DMA가 비워줄 때까지
+ * timeout_ms 동안 기다린다.
+ *
+ * @param tx 송신 포트
+ * @param data 데이터
+ * @param len 길이
+ * @param timeout_ms 공간 대기 시간
+ * @return int 링에 넣은 바이트 수, 실패 시 -1
+ */
+int uart_tx_send(uart_tx_t *tx, const void *data, size_t len,
+                 uint32_t timeout_ms);
+
+/**
+ * @brief 링 버퍼의 데이터가 모두 나갈 때까지 대기
+ *
+ * 마지막 바이트의 stop 비트까지 (USART TC) 기다린다.
+ *
+ * @param tx 송신 포트
+ * @param timeout_ms 대기 시간
+ * @return int 0: 완료, -1: 타임아웃
+ */
+int uart_tx_flush(uart_tx_t *tx, uint32_t timeout_ms);
+
+/**
+ * @brief 전송 완료 콜백 등록
+ *
+ * @param tx 송신 포트
+ * @param cb 콜백 (NULL: 해제)
+ * @param arg 콜백 인자
+ */
+void uart_tx_set_done_cb(uart_tx_t *tx, uart_tx_done_cb_t cb, void *arg);
+
+/**
+ * @brief 송신 중 여부
+ *
+ * @param tx 송신 포트
+ * @return true: 링에 남은 데이터 있음
+ */
+bool uart_tx_is_busy(const uart_tx_t *tx);
+
+/**
+ * @brief DMA 스트림 인터럽트 처리 (해당 DMAx_Streamy_IRQHandler에서 호출)
+ *
+ * @param tx 송신 포트
+ */
+void uart_tx_irq_handler(uart_tx_t *tx);
+
+#endif
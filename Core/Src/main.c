@@ -26,6 +26,7 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "FreeRTOS.h"
+#include "SEGGER_RTT.h"
 #include "SEGGER_SYSVIEW.h"
 #include "gps.h"
 #include "gps_app.h"
@@ -34,6 +35,8 @@
 #include "semphr.h"
 #include "task.h"
 #include "led.h"
+#include "log.h"
+#include "uart_tx.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -43,6 +46,10 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define DEBUG_UART_TX_BUF_SIZE 1024
+
+/* 로그 출력 (1: USART6 DMA, 0: SEGGER RTT 채널 0) */
+#define LOG_OUTPUT_UART 0
 
 /* USER CODE END PD */
 
@@ -54,6 +61,18 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
+static uint8_t debug_uart_tx_buf[DEBUG_UART_TX_BUF_SIZE];
+
+// USART6_TX (디버그): DMA2 Stream6 Channel5
+uart_tx_t debug_uart_tx = {
+  .uart = USART6,
+  .dma = DMA2,
+  .stream = LL_DMA_STREAM_6,
+  .channel = LL_DMA_CHANNEL_5,
+  .irqn = DMA2_Stream6_IRQn,
+  .ring = debug_uart_tx_buf,
+  .ring_size = sizeof(debug_uart_tx_buf),
+};
 
 /* USER CODE END PV */
 
@@ -65,7 +84,24 @@ void SystemClock_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+ * @brief UART 송신
+ *
+ * 디버그 포트(USART6)는 스케줄러 시작 후 DMA 송신 링으로 보내고 바로 반환한다.
+ * 그 외 포트나 스케줄러 시작 전에는 폴링으로 보낸다.
+ *
+ * @param handle USART
+ * @param buf 데이터
+ * @param len 길이
+ * @return uint32_t 보낸(링에 넣은) 바이트 수
+ */
 uint32_t uart_send(USART_TypeDef *handle, const char *buf, size_t len) {
+  if (handle == debug_uart_tx.uart && debug_uart_tx.lock &&
+      xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) {
+    int ret = uart_tx_send(&debug_uart_tx, buf, len, portMAX_DELAY);
+    return ret < 0 ? 0 : (uint32_t)ret;
+  }
+
   for (int i = 0; i < len; i++) {
     while (!LL_USART_IsActiveFlag_TXE(handle))
       ;
@@ -101,6 +137,24 @@ void initThread(void *pvParameter) {
   vTaskDelete(NULL);
 }
 
+/**
+ * @brief 로그 drain 태스크 출력 백엔드
+ */
+static int log_output_write(const char *data, size_t len) {
+#if LOG_OUTPUT_UART
+  return uart_tx_send(&debug_uart_tx, data, len, portMAX_DELAY);
+#else
+  return (int)SEGGER_RTT_Write(0, data, len);
+#endif
+}
+
+/**
+ * @brief This function handles DMA2 stream6 global interrupt (USART6_TX).
+ */
+void DMA2_Stream6_IRQHandler(void) {
+  uart_tx_irq_handler(&debug_uart_tx);
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -144,6 +198,10 @@ int main(void) {
   MX_ADC1_Init();
   //  MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  uart_tx_init(&debug_uart_tx);
+  log_set_output(log_output_write);
+  log_init();
+
   xTaskCreate(initThread, "init", 2048, NULL, tskIDLE_PRIORITY + 1, NULL);
 
   vTaskStartScheduler();
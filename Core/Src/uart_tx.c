@@ -0,0 +1,310 @@
+#include "uart_tx.h"
+#include "stm32f4xx_ll_bus.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_usart.h"
+#include "task.h"
+#include <string.h>
+
+/* DMA_LISR/HISR 안에서 스트림별 플래그 시작 비트 (스트림 번호 & 3) */
+static const uint8_t uart_tx_flag_shift[4] = {0, 6, 16, 22};
+
+#define UART_TX_FLAG_FE (1u << 0)
+#define UART_TX_FLAG_DME (1u << 2)
+#define UART_TX_FLAG_TE (1u << 3)
+#define UART_TX_FLAG_HT (1u << 4)
+#define UART_TX_FLAG_TC (1u << 5)
+#define UART_TX_FLAG_ALL                                                       \
+  (UART_TX_FLAG_FE | UART_TX_FLAG_DME | UART_TX_FLAG_TE | UART_TX_FLAG_HT |   \
+   UART_TX_FLAG_TC)
+
+/* done_evt 비트: DMA 구간 완료 (세마포어와 달리 대기 태스크를 모두 깨움) */
+#define UART_TX_EVT_DONE (1u << 0)
+
+static inline uint32_t uart_tx_dma_get_flags(const uart_tx_t *tx) {
+  uint32_t isr =
+      (tx->stream < LL_DMA_STREAM_4) ? tx->dma->LISR : tx->dma->HISR;
+
+  return (isr >> uart_tx_flag_shift[tx->stream & 3]) & UART_TX_FLAG_ALL;
+}
+
+static inline void uart_tx_dma_clear_flags(const uart_tx_t *tx,
+                                           uint32_t flags) {
+  uint32_t val = flags << uart_tx_flag_shift[tx->stream & 3];
+
+  if (tx->stream < LL_DMA_STREAM_4) {
+    tx->dma->LIFCR = val;
+  } else {
+    tx->dma->HIFCR = val;
+  }
+}
+
+/**
+ * @brief 유휴 상태면 링의 다음 연속 구간으로 DMA 전송 시작
+ *
+ * 태스크에서는 critical section 안에서, ISR에서는 그대로 호출한다.
+ *
+ * @param tx 송신 포트
+ */
+static void uart_tx_kick(uart_tx_t *tx) {
+  size_t head = tx->head;
+  size_t tail = tx->tail;
+  size_t len;
+
+  if (tx->dma_len != 0 || head == tail) {
+    return;
+  }
+
+  // 링 끝에서 감긴 부분은 이번 전송 완료 후 이어서 보냄
+  len = (head > tail) ? (head - tail) : (tx->ring_size - tail);
+
+  LL_DMA_SetMemoryAddress(tx->dma, tx->stream, (uint32_t)&tx->ring[tail]);
+  LL_DMA_SetDataLength(tx->dma, tx->stream, len);
+  uart_tx_dma_clear_flags(tx, UART_TX_FLAG_ALL);
+  LL_USART_ClearFlag_TC(tx->uart);
+
+  tx->dma_len = len;
+  LL_DMA_EnableStream(tx->dma, tx->stream);
+}
+
+/**
+ * @brief 대기 조건이 아직 그대로면 완료 비트를 내리고 대기 준비
+ *
+ * 조건이 그대로라는 것은 DMA가 돌고 있다는 뜻이므로 완료 인터럽트가 반드시
+ * 다시 온다. 비트를 내린 뒤 블록한 태스크는 모두 그 인터럽트에서 함께 깨어난다.
+ *
+ * @param tx 송신 포트
+ * @param tail 송신자가 본 tail (flush는 무시)
+ * @param flush true: 링이 빌 때까지, false: tail이 움직일 때까지
+ * @return true: 대기해야 함
+ */
+static bool uart_tx_arm_wait(uart_tx_t *tx, size_t tail, bool flush) {
+  bool armed;
+
+  taskENTER_CRITICAL();
+  armed = flush ? uart_tx_is_busy(tx) : (tx->tail == tail);
+  if (armed) {
+    xEventGroupClearBits(tx->done_evt, UART_TX_EVT_DONE);
+  }
+  taskEXIT_CRITICAL();
+
+  return armed;
+}
+
+/**
+ * @brief DMA 송신 포트 초기화
+ */
+int uart_tx_init(uart_tx_t *tx) {
+  if (!tx || !tx->uart || !tx->dma || !tx->ring || tx->ring_size < 2) {
+    return -1;
+  }
+
+  tx->head = 0;
+  tx->tail = 0;
+  tx->dma_len = 0;
+
+  if (!tx->lock) {
+    tx->lock = xSemaphoreCreateMutex();
+  }
+  if (!tx->done_evt) {
+    tx->done_evt = xEventGroupCreate();
+  }
+  if (!tx->lock || !tx->done_evt) {
+    return -1;
+  }
+
+  LL_AHB1_GRP1_EnableClock(tx->dma == DMA1 ? LL_AHB1_GRP1_PERIPH_DMA1
+                                           : LL_AHB1_GRP1_PERIPH_DMA2);
+
+  LL_DMA_DisableStream(tx->dma, tx->stream);
+  while (LL_DMA_IsEnabledStream(tx->dma, tx->stream))
+    ;
+
+  LL_DMA_SetChannelSelection(tx->dma, tx->stream, tx->channel);
+
+  LL_DMA_SetDataTransferDirection(tx->dma, tx->stream,
+                                  LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+
+  LL_DMA_SetStreamPriorityLevel(tx->dma, tx->stream, LL_DMA_PRIORITY_LOW);
+
+  LL_DMA_SetMode(tx->dma, tx->stream, LL_DMA_MODE_NORMAL);
+
+  LL_DMA_SetPeriphIncMode(tx->dma, tx->stream, LL_DMA_PERIPH_NOINCREMENT);
+
+  LL_DMA_SetMemoryIncMode(tx->dma, tx->stream, LL_DMA_MEMORY_INCREMENT);
+
+  LL_DMA_SetPeriphSize(tx->dma, tx->stream, LL_DMA_PDATAALIGN_BYTE);
+
+  LL_DMA_SetMemorySize(tx->dma, tx->stream, LL_DMA_MDATAALIGN_BYTE);
+
+  LL_DMA_DisableFifoMode(tx->dma, tx->stream);
+
+  LL_DMA_SetPeriphAddress(tx->dma, tx->stream, (uint32_t)&tx->uart->DR);
+
+  uart_tx_dma_clear_flags(tx, UART_TX_FLAG_ALL);
+  LL_DMA_EnableIT_TC(tx->dma, tx->stream);
+  LL_DMA_EnableIT_TE(tx->dma, tx->stream);
+
+  NVIC_SetPriority(tx->irqn,
+                   NVIC_EncodePriority(NVIC_GetPriorityGrouping(), 5, 0));
+  NVIC_EnableIRQ(tx->irqn);
+
+  LL_USART_EnableDMAReq_TX(tx->uart);
+
+  return 0;
+}
+
+/**
+ * @brief 비동기 송신
+ */
+int uart_tx_send(uart_tx_t *tx, const void *data, size_t len,
+                 uint32_t timeout_ms) {
+  const uint8_t *p = (const uint8_t *)data;
+  TickType_t start = xTaskGetTickCount();
+  TickType_t wait = (timeout_ms == portMAX_DELAY) ? portMAX_DELAY
+                                                  : pdMS_TO_TICKS(timeout_ms);
+  size_t done = 0;
+
+  if (!tx || !tx->lock || (len > 0 && !data)) {
+    return -1;
+  }
+
+  if (xSemaphoreTake(tx->lock, wait) != pdTRUE) {
+    return -1;
+  }
+
+  while (done < len) {
+    size_t head = tx->head;
+    size_t tail = tx->tail;
+    size_t space = (tail + tx->ring_size - head - 1) % tx->ring_size;
+
+    if (space == 0) {
+      // 링이 가득 참: DMA 완료 인터럽트가 깨워줄 때까지 대기
+      TickType_t elapsed = xTaskGetTickCount() - start;
+
+      if (wait != portMAX_DELAY && elapsed >= wait) {
+        break;
+      }
+
+      // 검사 이후 완료 인터럽트가 이미 지나갔으면 비트를 내리지 않고 다시 확인
+      if (uart_tx_arm_wait(tx, tail, false)) {
+        xEventGroupWaitBits(tx->done_evt, UART_TX_EVT_DONE, pdFALSE, pdFALSE,
+                            wait == portMAX_DELAY ? portMAX_DELAY
+                                                  : wait - elapsed);
+      }
+      continue;
+    }
+
+    size_t n = len - done;
+    if (n > space) {
+      n = space;
+    }
+    if (n > tx->ring_size - head) {
+      n = tx->ring_size - head;
+    }
+
+    memcpy(&tx->ring[head], &p[done], n);
+    done += n;
+
+    taskENTER_CRITICAL();
+    tx->head = (head + n) % tx->ring_size;
+    uart_tx_kick(tx);
+    taskEXIT_CRITICAL();
+  }
+
+  xSemaphoreGive(tx->lock);
+
+  if (done == 0 && len > 0) {
+    return -1;
+  }
+
+  return (int)done;
+}
+
+/**
+ * @brief 링 버퍼의 데이터가 모두 나갈 때까지 대기
+ */
+int uart_tx_flush(uart_tx_t *tx, uint32_t timeout_ms) {
+  TickType_t start = xTaskGetTickCount();
+  TickType_t wait = (timeout_ms == portMAX_DELAY) ? portMAX_DELAY
+                                                  : pdMS_TO_TICKS(timeout_ms);
+
+  if (!tx || !tx->done_evt) {
+    return -1;
+  }
+
+  while (uart_tx_is_busy(tx)) {
+    TickType_t elapsed = xTaskGetTickCount() - start;
+
+    if (wait != portMAX_DELAY && elapsed >= wait) {
+      return -1;
+    }
+
+    // 송신 락 없이 기다리므로 송신자, 다른 flush와 동시에 대기할 수 있음
+    if (uart_tx_arm_wait(tx, 0, true)) {
+      xEventGroupWaitBits(tx->done_evt, UART_TX_EVT_DONE, pdFALSE, pdFALSE,
+                          wait == portMAX_DELAY ? portMAX_DELAY
+                                                : wait - elapsed);
+    }
+  }
+
+  // DMA 완료는 마지막 바이트가 DR로 옮겨진 시점, stop 비트까지는 TC로 확인
+  while (!LL_USART_IsActiveFlag_TC(tx->uart)) {
+    if (wait != portMAX_DELAY && xTaskGetTickCount() - start >= wait) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * @brief 전송 완료 콜백 등록
+ */
+void uart_tx_set_done_cb(uart_tx_t *tx, uart_tx_done_cb_t cb, void *arg) {
+  if (!tx) {
+    return;
+  }
+
+  taskENTER_CRITICAL();
+  tx->done_cb = cb;
+  tx->done_arg = arg;
+  taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief 송신 중 여부
+ */
+bool uart_tx_is_busy(const uart_tx_t *tx) {
+  return tx->head != tx->tail;
+}
+
+/**
+ * @brief DMA 스트림 인터럽트 처리
+ */
+void uart_tx_irq_handler(uart_tx_t *tx) {
+  BaseType_t woken = pdFALSE;
+  uint32_t flags = uart_tx_dma_get_flags(tx);
+
+  uart_tx_dma_clear_flags(tx, flags);
+
+  // TE도 스트림이 꺼지므로 해당 구간은 버리고 다음 구간으로 진행
+  if (flags & (UART_TX_FLAG_TC | UART_TX_FLAG_TE)) {
+    if (tx->dma_len != 0) {
+      tx->tail = (tx->tail + tx->dma_len) % tx->ring_size;
+      tx->dma_len = 0;
+    }
+
+    uart_tx_kick(tx);
+
+    // 비트가 내려가 있을 때만 = 누군가 대기 중일 때만 타이머 태스크로 넘김
+    if (!(xEventGroupGetBitsFromISR(tx->done_evt) & UART_TX_EVT_DONE)) {
+      xEventGroupSetBitsFromISR(tx->done_evt, UART_TX_EVT_DONE, &woken);
+    }
+
+    if (tx->dma_len == 0 && tx->done_cb) {
+      tx->done_cb(tx->done_arg, &woken);
+    }
+  }
+
+  portYIELD_FROM_ISR(woken);
+}
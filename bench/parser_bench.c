@@ -0,0 +1,320 @@
+#include "parser_bench.h"
+#include "FreeRTOS.h"
+#include "gps.h"
+#include "gsm.h"
+#include "lora.h"
+#include "rtcm.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(PARSER_BENCH_USE_DWT)
+#include "stm32f4xx.h"
+#else
+#include <time.h>
+#endif
+
+#ifndef PARSER_BENCH_STREAM_SIZE
+#define PARSER_BENCH_STREAM_SIZE (16 * 1024)
+#endif
+
+/* 타이머 ---------------------------------------------------------------------*/
+
+#if defined(PARSER_BENCH_USE_DWT)
+
+void parser_bench_timer_init(void) {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t parser_bench_now(void) { return DWT->CYCCNT; }
+
+uint64_t parser_bench_ticks_to_ns(uint64_t ticks) {
+  return ticks * 1000U / (SystemCoreClock / 1000000U);
+}
+
+#else
+
+void parser_bench_timer_init(void) {}
+
+uint32_t parser_bench_now(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+
+uint64_t parser_bench_ticks_to_ns(uint64_t ticks) { return ticks; }
+
+#endif
+
+/* 실행/출력 ------------------------------------------------------------------*/
+
+static uint32_t count_lines(const uint8_t *data, size_t len) {
+  uint32_t n = 0;
+
+  for (size_t i = 1; i < len; i++) {
+    if (data[i - 1] == '\r' && data[i] == '\n') {
+      n++;
+    }
+  }
+  return n;
+}
+
+void parser_bench_run(const parser_bench_target_t *target, const uint8_t *data,
+                      size_t len, size_t chunk, uint32_t repeat,
+                      parser_bench_result_t *res) {
+  memset(res, 0, sizeof(*res));
+  res->name = target->name;
+
+  if (!data || len == 0 || chunk == 0) {
+    return;
+  }
+
+  if (target->init) {
+    target->init(target->ctx);
+  }
+
+  for (uint32_t r = 0; r < repeat; r++) {
+    for (size_t off = 0; off < len; off += chunk) {
+      size_t n = len - off < chunk ? len - off : chunk;
+
+      uint32_t start = parser_bench_now();
+      target->feed(target->ctx, &data[off], n);
+      uint32_t elapsed = parser_bench_now() - start;
+
+      res->total_ticks += elapsed;
+      res->calls++;
+      if (elapsed > res->worst_ticks) {
+        res->worst_ticks = elapsed;
+        res->worst_len = (uint32_t)n;
+      }
+    }
+  }
+
+  res->bytes = (uint64_t)len * repeat;
+  res->frames = target->frames ? target->frames(target->ctx)
+                               : count_lines(data, len) * repeat;
+}
+
+void parser_bench_print_header(void) {
+  printf("%-12s %10s %8s %8s %10s %10s %12s %10s\r\n", "parser", "bytes",
+         "frames", "calls", "ns/byte", "MB/s", "frames/s", "worst(us)");
+}
+
+void parser_bench_print(const parser_bench_result_t *res) {
+  uint64_t ns = parser_bench_ticks_to_ns(res->total_ticks);
+  uint64_t worst_ns = parser_bench_ticks_to_ns(res->worst_ticks);
+  uint64_t ns_per_byte_m = 0; // 1/1000 ns 단위
+  uint64_t kb_per_s = 0;
+  uint64_t frames_per_s = 0;
+
+  // 타겟 printf(newlib-nano)는 float 미지원일 수 있어 정수 고정소수점으로 출력
+  if (res->bytes > 0) {
+    ns_per_byte_m = ns * 1000U / res->bytes;
+  }
+  if (ns > 0) {
+    kb_per_s = res->bytes * 1000000ULL / ns;
+    frames_per_s = (uint64_t)res->frames * 1000000000ULL / ns;
+  }
+
+  printf("%-12s %10lu %8lu %8lu %6lu.%03lu %6lu.%03lu %12lu %6lu.%03lu\r\n",
+         res->name, (unsigned long)res->bytes, (unsigned long)res->frames,
+         (unsigned long)res->calls, (unsigned long)(ns_per_byte_m / 1000U),
+         (unsigned long)(ns_per_byte_m % 1000U),
+         (unsigned long)(kb_per_s / 1000U), (unsigned long)(kb_per_s % 1000U),
+         (unsigned long)frames_per_s, (unsigned long)(worst_ns / 1000U),
+         (unsigned long)(worst_ns % 1000U));
+}
+
+/* GPS (gps_parse_process) ---------------------------------------------------*/
+
+static gps_t bench_gps;
+static uint32_t bench_gps_frames;
+
+static void bench_gps_evt(gps_t *gps, gps_event_t event,
+                          gps_procotol_t protocol, gps_msg_t msg) {
+  (void)gps;
+  (void)event;
+  (void)protocol;
+  (void)msg;
+  bench_gps_frames++;
+}
+
+static void bench_gps_init(void *ctx) {
+  gps_t *gps = ctx;
+
+  if (!gps->mutex) {
+    gps_init(gps);
+  } else {
+    // 뮤텍스는 재사용 (FreeRTOS 객체 누수 방지)
+    SemaphoreHandle_t mutex = gps->mutex;
+    gps_init(gps);
+    vSemaphoreDelete(gps->mutex);
+    gps->mutex = mutex;
+  }
+  gps_set_evt_handler(gps, bench_gps_evt);
+  bench_gps_frames = 0;
+}
+
+static void bench_gps_feed(void *ctx, const uint8_t *data, size_t len) {
+  gps_parse_process(ctx, data, len);
+}
+
+static uint32_t bench_gps_count(void *ctx) {
+  (void)ctx;
+  return bench_gps_frames;
+}
+
+parser_bench_target_t parser_bench_gps = {
+  .name = "gps",
+  .init = bench_gps_init,
+  .feed = bench_gps_feed,
+  .frames = bench_gps_count,
+  .ctx = &bench_gps,
+};
+
+/* RTCM (rtcm_parse_byte / rtcm_parse_block) ---------------------------------*/
+
+static rtcm_parser_t bench_rtcm;
+
+static void bench_rtcm_init(void *ctx) {
+  rtcm_parser_t *parser = ctx;
+
+  rtcm_parser_reset(parser);
+  parser->packet_count = 0;
+  parser->error_count = 0;
+}
+
+static void bench_rtcm_byte_feed(void *ctx, const uint8_t *data, size_t len) {
+  rtcm_parser_t *parser = ctx;
+
+  for (size_t i = 0; i < len; i++) {
+    rtcm_parse_byte(parser, data[i]);
+  }
+}
+
+static void bench_rtcm_block_feed(void *ctx, const uint8_t *data, size_t len) {
+  rtcm_parser_t *parser = ctx;
+
+  while (len > 0) {
+    size_t n = 0;
+
+    if (parser->current_packet.state == RTCM_PARSE_STATE_COMPLETE) {
+      rtcm_parser_reset(parser);
+    }
+
+    rtcm_parse_block(parser, data, len, &n);
+    if (n == 0) {
+      n = 1; // sync 아님
+    }
+    data += n;
+    len -= n;
+  }
+}
+
+static uint32_t bench_rtcm_count(void *ctx) {
+  return ((rtcm_parser_t *)ctx)->packet_count;
+}
+
+parser_bench_target_t parser_bench_rtcm_byte = {
+  .name = "rtcm_byte",
+  .init = bench_rtcm_init,
+  .feed = bench_rtcm_byte_feed,
+  .frames = bench_rtcm_count,
+  .ctx = &bench_rtcm,
+};
+
+parser_bench_target_t parser_bench_rtcm_block = {
+  .name = "rtcm_block",
+  .init = bench_rtcm_init,
+  .feed = bench_rtcm_block_feed,
+  .frames = bench_rtcm_count,
+  .ctx = &bench_rtcm,
+};
+
+/* GSM (gsm_parse_process) ---------------------------------------------------*/
+
+static gsm_t bench_gsm;
+
+static void bench_gsm_init(void *ctx) {
+  gsm_t *gsm = ctx;
+
+  if (!gsm->cmd_mutex) {
+    gsm_init(gsm, NULL, NULL);
+  }
+}
+
+static void bench_gsm_feed(void *ctx, const uint8_t *data, size_t len) {
+  gsm_parse_process(ctx, data, len);
+}
+
+parser_bench_target_t parser_bench_gsm = {
+  .name = "gsm",
+  .init = bench_gsm_init,
+  .feed = bench_gsm_feed,
+  .frames = NULL,
+  .ctx = &bench_gsm,
+};
+
+/* LoRa (lora_uart_rx_process) -----------------------------------------------*/
+
+static lora_t bench_lora;
+static lora_at_cmd_t bench_lora_cmd;
+
+static void bench_lora_init(void *ctx) {
+  lora_t *lora = ctx;
+
+  // lora_init()은 태스크를 만들므로 파서에 필요한 것만 준비
+  if (!lora->cmd_mutex) {
+    lora->cmd_mutex = xSemaphoreCreateMutex();
+    lora->producer_sem = xSemaphoreCreateBinary();
+  }
+  // 응답 파서는 진행 중 명령이 있을 때만 줄을 해석함
+  lora->current_cmd = &bench_lora_cmd;
+  lora->recv.len = 0;
+}
+
+static void bench_lora_feed(void *ctx, const uint8_t *data, size_t len) {
+  lora_uart_rx_process(ctx, data, len);
+}
+
+parser_bench_target_t parser_bench_lora = {
+  .name = "lora",
+  .init = bench_lora_init,
+  .feed = bench_lora_feed,
+  .frames = NULL,
+  .ctx = &bench_lora,
+};
+
+/* 전체 실행 ------------------------------------------------------------------*/
+
+static uint8_t bench_stream[PARSER_BENCH_STREAM_SIZE];
+
+void parser_bench_run_all(size_t chunk, uint32_t repeat) {
+  parser_bench_result_t res;
+  size_t len;
+
+  parser_bench_timer_init();
+  parser_bench_print_header();
+
+  len = parser_bench_gen_gps(bench_stream, sizeof(bench_stream));
+  parser_bench_run(&parser_bench_gps, bench_stream, len, chunk, repeat, &res);
+  parser_bench_print(&res);
+
+  len = parser_bench_gen_rtcm(bench_stream, sizeof(bench_stream));
+  parser_bench_run(&parser_bench_rtcm_byte, bench_stream, len, chunk, repeat,
+                   &res);
+  parser_bench_print(&res);
+  parser_bench_run(&parser_bench_rtcm_block, bench_stream, len, chunk, repeat,
+                   &res);
+  parser_bench_print(&res);
+
+  len = parser_bench_gen_gsm(bench_stream, sizeof(bench_stream));
+  parser_bench_run(&parser_bench_gsm, bench_stream, len, chunk, repeat, &res);
+  parser_bench_print(&res);
+
+  len = parser_bench_gen_lora(bench_stream, sizeof(bench_stream));
+  parser_bench_run(&parser_bench_lora, bench_stream, len, chunk, repeat, &res);
+  parser_bench_print(&res);
+}
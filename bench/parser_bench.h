@@ -0,0 +1,137 @@
+#ifndef PARSER_BENCH_H
+#define PARSER_BENCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 파서 처리량 벤치마크
+ *
+ * 캡처 스트림을 DMA 청크 크기로 잘라 파서에 넣고, 호출마다 시간을 잰다.
+ * - 호스트: clock_gettime(CLOCK_MONOTONIC), 단위 ns
+ * - 타겟 (PARSER_BENCH_USE_DWT): DWT CYCCNT, 단위 CPU 사이클
+ *
+ * 결과: ns/byte, 초당 프레임 수, 호출당 최악 지연
+ */
+
+/**
+ * @brief 벤치마크 대상 파서
+ */
+typedef struct {
+  const char *name;
+
+  /**
+   * @brief 파서 상태 초기화 (측정 제외)
+   */
+  void (*init)(void *ctx);
+
+  /**
+   * @brief 청크 하나 처리 (측정 대상)
+   */
+  void (*feed)(void *ctx, const uint8_t *data, size_t len);
+
+  /**
+   * @brief 지금까지 완성된 프레임 수 (NULL이면 CRLF 줄 수로 계산)
+   */
+  uint32_t (*frames)(void *ctx);
+
+  void *ctx;
+} parser_bench_target_t;
+
+/**
+ * @brief 벤치마크 결과
+ */
+typedef struct {
+  const char *name;
+  uint64_t bytes;       ///< 처리한 총 바이트
+  uint32_t frames;      ///< 완성된 프레임 수
+  uint32_t calls;       ///< feed 호출 수
+  uint64_t total_ticks; ///< feed 누적 시간
+  uint32_t worst_ticks; ///< feed 1회 최악 시간
+  uint32_t worst_len;   ///< 최악 시간이 나온 청크 길이
+} parser_bench_result_t;
+
+/**
+ * @brief 타이머 준비 (타겟: DWT 사이클 카운터 활성화)
+ */
+void parser_bench_timer_init(void);
+
+/**
+ * @brief 현재 타이머 값 (호스트: ns, 타겟: 사이클)
+ */
+uint32_t parser_bench_now(void);
+
+/**
+ * @brief 타이머 값을 ns로 변환
+ */
+uint64_t parser_bench_ticks_to_ns(uint64_t ticks);
+
+/**
+ * @brief 스트림을 청크 단위로 재생하며 측정
+ *
+ * @param target 대상 파서
+ * @param data 캡처 스트림
+ * @param len 스트림 길이
+ * @param chunk 청크 크기 (DMA IDLE 1회 분량 대응)
+ * @param repeat 스트림 반복 횟수
+ * @param[out] res 결과
+ */
+void parser_bench_run(const parser_bench_target_t *target, const uint8_t *data,
+                      size_t len, size_t chunk, uint32_t repeat,
+                      parser_bench_result_t *res);
+
+/**
+ * @brief 결과 표 머리글 출력
+ */
+void parser_bench_print_header(void);
+
+/**
+ * @brief 결과 한 줄 출력
+ */
+void parser_bench_print(const parser_bench_result_t *res);
+
+/* 합성 캡처 -----------------------------------------------------------------*/
+
+/**
+ * @brief F9P/UM982 혼합 스트림 생성
+ *
+ * NMEA GGA/RMC, UBX NAV-HPPOSLLH, RTCM 1005 + MSM4/MSM7, Unicore 바이너리,
+ * Unicore 명령 응답을 1 Hz 에포크 순서로 채운다.
+ *
+ * @return 채운 바이트 수
+ */
+size_t parser_bench_gen_gps(uint8_t *buf, size_t size);
+
+/**
+ * @brief RTCM3 전용 스트림 생성 (1005, MSM4, MSM7)
+ */
+size_t parser_bench_gen_rtcm(uint8_t *buf, size_t size);
+
+/**
+ * @brief EC25 AT 응답/URC 스트림 생성
+ */
+size_t parser_bench_gen_gsm(uint8_t *buf, size_t size);
+
+/**
+ * @brief RAK4270 P2P 수신 이벤트 스트림 생성
+ */
+size_t parser_bench_gen_lora(uint8_t *buf, size_t size);
+
+/* 파서 대상 -----------------------------------------------------------------*/
+
+extern parser_bench_target_t parser_bench_gps;
+extern parser_bench_target_t parser_bench_rtcm_byte;
+extern parser_bench_target_t parser_bench_rtcm_block;
+extern parser_bench_target_t parser_bench_gsm;
+extern parser_bench_target_t parser_bench_lora;
+
+/**
+ * @brief 합성 스트림으로 전체 파서 측정 (타겟 실행용)
+ *
+ * @param chunk 청크 크기
+ * @param repeat 반복 횟수
+ */
+void parser_bench_run_all(size_t chunk, uint32_t repeat);
+
+#endif /* PARSER_BENCH_H */
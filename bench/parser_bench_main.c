@@ -0,0 +1,150 @@
+#include "FreeRTOS.h"
+#include "task.h"
+#include "parser_bench.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief 파서 벤치마크 호스트 실행 파일
+ *
+ * 캡처 파일을 지정하지 않은 파서는 합성 스트림으로 측정한다.
+ *
+ *   ./parser_bench -g um982_capture.bin -m ec25_transcript.txt -c 64 -n 100
+ */
+
+#define BENCH_SYNTH_SIZE (256 * 1024)
+
+typedef struct {
+  const char *path;
+  size_t (*gen)(uint8_t *buf, size_t size);
+  parser_bench_target_t *targets[2];
+} bench_input_t;
+
+static bench_input_t inputs[] = {
+  {NULL, parser_bench_gen_gps, {&parser_bench_gps, NULL}},
+  {NULL, parser_bench_gen_rtcm, {&parser_bench_rtcm_byte, &parser_bench_rtcm_block}},
+  {NULL, parser_bench_gen_gsm, {&parser_bench_gsm, NULL}},
+  {NULL, parser_bench_gen_lora, {&parser_bench_lora, NULL}},
+};
+
+static size_t bench_chunk = 64;
+static uint32_t bench_repeat = 20;
+
+static uint8_t *load_file(const char *path, size_t *len) {
+  FILE *fp = fopen(path, "rb");
+  uint8_t *buf = NULL;
+  long size;
+
+  if (!fp) {
+    fprintf(stderr, "open failed: %s\n", path);
+    return NULL;
+  }
+
+  fseek(fp, 0, SEEK_END);
+  size = ftell(fp);
+  fseek(fp, 0, SEEK_SET);
+
+  if (size > 0) {
+    buf = malloc((size_t)size);
+    if (buf && fread(buf, 1, (size_t)size, fp) != (size_t)size) {
+      free(buf);
+      buf = NULL;
+    }
+  }
+  fclose(fp);
+
+  *len = buf ? (size_t)size : 0;
+  return buf;
+}
+
+static void bench_task(void *param) {
+  (void)param;
+  parser_bench_result_t res;
+
+  printf("chunk=%lu repeat=%lu\r\n", (unsigned long)bench_chunk,
+         (unsigned long)bench_repeat);
+  parser_bench_timer_init();
+  parser_bench_print_header();
+
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    bench_input_t *in = &inputs[i];
+    uint8_t *data;
+    size_t len;
+
+    if (in->path) {
+      data = load_file(in->path, &len);
+    } else {
+      data = malloc(BENCH_SYNTH_SIZE);
+      len = data ? in->gen(data, BENCH_SYNTH_SIZE) : 0;
+    }
+
+    if (!data) {
+      continue;
+    }
+
+    for (size_t t = 0; t < 2 && in->targets[t]; t++) {
+      parser_bench_run(in->targets[t], data, len, bench_chunk, bench_repeat,
+                       &res);
+      parser_bench_print(&res);
+    }
+
+    free(data);
+  }
+
+  fflush(stdout);
+  exit(0);
+}
+
+int main(int argc, char *argv[]) {
+  int opt;
+
+  while ((opt = getopt(argc, argv, "g:r:m:l:c:n:h")) != -1) {
+    switch (opt) {
+    case 'g':
+      inputs[0].path = optarg;
+      break;
+    case 'r':
+      inputs[1].path = optarg;
+      break;
+    case 'm':
+      inputs[2].path = optarg;
+      break;
+    case 'l':
+      inputs[3].path = optarg;
+      break;
+    case 'c':
+      bench_chunk = strtoul(optarg, NULL, 10);
+      break;
+    case 'n':
+      bench_repeat = (uint32_t)strtoul(optarg, NULL, 10);
+      break;
+    default:
+      fprintf(stderr,
+              "usage: %s [-g gps] [-r rtcm] [-m ec25] [-l lora] [-c chunk] "
+              "[-n repeat]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+
+  if (bench_chunk == 0) {
+    bench_chunk = 1;
+  }
+
+  xTaskCreate(bench_task, "bench", configMINIMAL_STACK_SIZE * 4, NULL,
+              configMAX_PRIORITIES - 1, NULL);
+  vTaskStartScheduler();
+
+  return 0;
+}
+
+void vApplicationMallocFailedHook(void) {
+  fprintf(stderr, "malloc failed\n");
+  abort();
+}
+
+void vAssertCalled(const char *file, int line) {
+  fprintf(stderr, "ASSERT %s:%d\n", file, line);
+  abort();
+}
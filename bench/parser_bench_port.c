@@ -0,0 +1,19 @@
+#include <stddef.h>
+
+/**
+ * @brief 벤치마크용 GSM HAL ops 대체 (modules/gsm/gsm_port.c 없이 링크)
+ */
+
+int gsm_port_reset(void) { return 0; }
+
+int gsm_uart_send(const char *data, size_t len) {
+  (void)data;
+  (void)len;
+  return 0;
+}
+
+int gsm_uart_send_async(const char *data, size_t len) {
+  (void)data;
+  (void)len;
+  return 0;
+}
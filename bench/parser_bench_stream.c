@@ -0,0 +1,299 @@
+#include "parser_bench.h"
+#include "rtcm.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief 합성 캡처 생성
+ *
+ * 실제 수신기 캡처가 없을 때(또는 타겟 실행 시) 쓰는 결정적 스트림.
+ * 프레임 구조/길이/체크섬은 실제와 같고, 페이로드 내용만 의사난수다.
+ * 메시지 길이는 F9P/UM982 실측 범위에 맞췄다.
+ */
+
+#define EPOCHS_MAX 1000
+
+typedef struct {
+  uint8_t *buf;
+  size_t size;
+  size_t pos;
+  uint32_t seed;
+} stream_t;
+
+static uint32_t rnd(stream_t *s) {
+  s->seed = s->seed * 1664525U + 1013904223U;
+  return s->seed >> 8;
+}
+
+static bool room(const stream_t *s, size_t len) { return s->pos + len <= s->size; }
+
+static void put(stream_t *s, const void *data, size_t len) {
+  memcpy(&s->buf[s->pos], data, len);
+  s->pos += len;
+}
+
+/* NMEA / Unicore ASCII -------------------------------------------------------*/
+
+static bool put_nmea(stream_t *s, const char *body) {
+  char line[128];
+  uint8_t crc = 0;
+
+  for (const char *p = body; *p; p++) {
+    crc ^= (uint8_t)*p;
+  }
+
+  int n = snprintf(line, sizeof(line), "$%s*%02X\r\n", body, crc);
+  if (n <= 0 || !room(s, (size_t)n)) {
+    return false;
+  }
+  put(s, line, (size_t)n);
+  return true;
+}
+
+static bool put_gga_rmc(stream_t *s, uint32_t epoch) {
+  char body[100];
+  uint32_t hh = 3, mm = (epoch / 60) % 60, ss = epoch % 60;
+  uint32_t frac = rnd(s) % 100000;
+
+  snprintf(body, sizeof(body),
+           "GNGGA,%02lu%02lu%02lu.00,3723.%05lu,N,12658.%05lu,E,4,32,0.5,"
+           "45.%03lu,M,18.3,M,1.0,0000",
+           (unsigned long)hh, (unsigned long)mm, (unsigned long)ss,
+           (unsigned long)frac, (unsigned long)((frac * 7) % 100000),
+           (unsigned long)(rnd(s) % 1000));
+  if (!put_nmea(s, body)) {
+    return false;
+  }
+
+  snprintf(body, sizeof(body),
+           "GNRMC,%02lu%02lu%02lu.00,A,3723.%05lu,N,12658.%05lu,E,0.01,,161026,"
+           ",,R,V",
+           (unsigned long)hh, (unsigned long)mm, (unsigned long)ss,
+           (unsigned long)frac, (unsigned long)((frac * 7) % 100000));
+  return put_nmea(s, body);
+}
+
+/* UBX ------------------------------------------------------------------------*/
+
+static bool put_ubx(stream_t *s, uint8_t cls, uint8_t id, uint16_t len) {
+  uint8_t ck_a = 0, ck_b = 0;
+  uint8_t hdr[6] = {0xB5, 0x62, cls, id, (uint8_t)len, (uint8_t)(len >> 8)};
+
+  if (!room(s, 8U + len)) {
+    return false;
+  }
+
+  put(s, hdr, sizeof(hdr));
+  for (uint16_t i = 0; i < len; i++) {
+    s->buf[s->pos++] = (uint8_t)rnd(s);
+  }
+
+  for (size_t i = s->pos - len - 4; i < s->pos; i++) {
+    ck_a += s->buf[i];
+    ck_b += ck_a;
+  }
+  s->buf[s->pos++] = ck_a;
+  s->buf[s->pos++] = ck_b;
+  return true;
+}
+
+/* RTCM3 ----------------------------------------------------------------------*/
+
+static bool put_rtcm(stream_t *s, uint16_t type, uint16_t len) {
+  uint8_t *frame = &s->buf[s->pos];
+  uint32_t crc;
+
+  if (!room(s, 6U + len)) {
+    return false;
+  }
+
+  frame[0] = RTCM3_PREAMBLE;
+  frame[1] = (uint8_t)((len >> 8) & 0x03);
+  frame[2] = (uint8_t)len;
+  for (uint16_t i = 0; i < len; i++) {
+    frame[3 + i] = (uint8_t)rnd(s);
+  }
+  // 메시지 번호 12비트
+  frame[3] = (uint8_t)(type >> 4);
+  frame[4] = (uint8_t)((type << 4) | (frame[4] & 0x0F));
+
+  crc = rtcm_crc24(frame, 3U + len);
+  frame[3 + len] = (uint8_t)(crc >> 16);
+  frame[4 + len] = (uint8_t)(crc >> 8);
+  frame[5 + len] = (uint8_t)crc;
+
+  s->pos += 6U + len;
+  return true;
+}
+
+static bool put_rtcm_epoch(stream_t *s, uint32_t epoch, bool msm7) {
+  static const uint16_t msm4_types[] = {1074, 1084, 1094, 1124};
+  static const uint16_t msm7_types[] = {1077, 1087, 1097, 1127};
+  const uint16_t *types = msm7 ? msm7_types : msm4_types;
+
+  // 1005 (기준국 좌표)는 10 에포크마다
+  if (epoch % 10 == 0 && !put_rtcm(s, 1005, 19)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 4; i++) {
+    uint16_t len = msm7 ? (uint16_t)(300 + rnd(s) % 300)
+                        : (uint16_t)(120 + rnd(s) % 150);
+    if (!put_rtcm(s, types[i], len)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Unicore 바이너리 -----------------------------------------------------------*/
+
+static uint32_t crc32_bitwise(const uint8_t *data, size_t len) {
+  uint32_t crc = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int j = 0; j < 8; j++) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320U : crc >> 1;
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief UM982 바이너리 메시지 (AA 44 B5, 24바이트 헤더 + 페이로드 + CRC32)
+ */
+static bool put_unicore_bin(stream_t *s, uint16_t msg_id, uint16_t len,
+                            uint32_t epoch) {
+  uint8_t *frame = &s->buf[s->pos];
+  uint32_t ms = epoch * 1000U;
+  uint32_t crc;
+
+  if (!room(s, 24U + len + 4U)) {
+    return false;
+  }
+
+  memset(frame, 0, 24);
+  frame[0] = 0xAA;
+  frame[1] = 0x44;
+  frame[2] = 0xB5;
+  frame[4] = (uint8_t)msg_id;
+  frame[5] = (uint8_t)(msg_id >> 8);
+  frame[6] = (uint8_t)len;
+  frame[7] = (uint8_t)(len >> 8);
+  frame[10] = (uint8_t)2400;
+  frame[11] = (uint8_t)(2400 >> 8);
+  frame[12] = (uint8_t)ms;
+  frame[13] = (uint8_t)(ms >> 8);
+  frame[14] = (uint8_t)(ms >> 16);
+  frame[15] = (uint8_t)(ms >> 24);
+  for (uint16_t i = 0; i < len; i++) {
+    frame[24 + i] = (uint8_t)rnd(s);
+  }
+
+  crc = crc32_bitwise(frame, 24U + len);
+  frame[24 + len] = (uint8_t)crc;
+  frame[25 + len] = (uint8_t)(crc >> 8);
+  frame[26 + len] = (uint8_t)(crc >> 16);
+  frame[27 + len] = (uint8_t)(crc >> 24);
+
+  s->pos += 24U + len + 4U;
+  return true;
+}
+
+/* 스트림 ---------------------------------------------------------------------*/
+
+size_t parser_bench_gen_gps(uint8_t *buf, size_t size) {
+  stream_t s = {.buf = buf, .size = size, .seed = 0x1234};
+
+  for (uint32_t epoch = 0; epoch < EPOCHS_MAX; epoch++) {
+    // F9P: NMEA + HPPOSLLH + RTCM 출력
+    if (!put_gga_rmc(&s, epoch) || !put_ubx(&s, 0x01, 0x14, 36) ||
+        !put_rtcm_epoch(&s, epoch, epoch % 2)) {
+      break;
+    }
+
+    // UM982: 바이너리 측위(BESTNAVB 2118) + 명령 응답
+    if (!put_unicore_bin(&s, 2118, 136, epoch)) {
+      break;
+    }
+    if (epoch % 5 == 0 && !put_nmea(&s, "command,mode base time 60,response: OK")) {
+      break;
+    }
+  }
+
+  return s.pos;
+}
+
+size_t parser_bench_gen_rtcm(uint8_t *buf, size_t size) {
+  stream_t s = {.buf = buf, .size = size, .seed = 0x5678};
+
+  for (uint32_t epoch = 0; epoch < EPOCHS_MAX; epoch++) {
+    if (!put_rtcm_epoch(&s, epoch, epoch % 2)) {
+      break;
+    }
+  }
+
+  return s.pos;
+}
+
+size_t parser_bench_gen_gsm(uint8_t *buf, size_t size) {
+  static const char *const lines[] = {
+    "\r\nOK\r\n",
+    "\r\n+CPIN: READY\r\n\r\nOK\r\n",
+    "\r\n+COPS: 0,0,\"SKTelecom\",7\r\n\r\nOK\r\n",
+    "\r\n+CGDCONT: 1,\"IP\",\"lte.sktelecom.com\",\"0.0.0.0\",0,0,0,0\r\n"
+    "\r\nOK\r\n",
+    "\r\n+QISTATE: 0,\"TCP\",\"210.117.198.84\",2101,0,2,1,0,0,\"uart1\"\r\n"
+    "\r\nOK\r\n",
+    "\r\nSEND OK\r\n",
+    "\r\nERROR\r\n",
+  };
+  stream_t s = {.buf = buf, .size = size, .seed = 0x9ABC};
+
+  while (1) {
+    const char *line = lines[rnd(&s) % (sizeof(lines) / sizeof(lines[0]))];
+    size_t len = strlen(line);
+
+    if (!room(&s, len)) {
+      break;
+    }
+    put(&s, line, len);
+  }
+
+  return s.pos;
+}
+
+size_t parser_bench_gen_lora(uint8_t *buf, size_t size) {
+  stream_t s = {.buf = buf, .size = size, .seed = 0xDEF0};
+  char line[300];
+
+  while (1) {
+    // RTCM 조각을 실은 P2P 패킷: +EVT:RXP2P:<rssi>:<snr>:<len>:<hex>
+    uint32_t len = 32 + rnd(&s) % 96;
+    int n = snprintf(line, sizeof(line), "+EVT:RXP2P:-%lu:%lu:%lu:",
+                     (unsigned long)(40 + rnd(&s) % 60),
+                     (unsigned long)(rnd(&s) % 12), (unsigned long)len);
+
+    for (uint32_t i = 0; i < len && n + 2 < (int)sizeof(line) - 2; i++) {
+      n += snprintf(&line[n], sizeof(line) - (size_t)n, "%02X",
+                    (unsigned)(rnd(&s) & 0xFF));
+    }
+    n += snprintf(&line[n], sizeof(line) - (size_t)n, "\r\n");
+
+    if (!room(&s, (size_t)n)) {
+      break;
+    }
+    put(&s, line, (size_t)n);
+
+    if (rnd(&s) % 8 == 0) {
+      const char *done = "+EVT:TXP2P DONE\r\n";
+      if (!room(&s, strlen(done))) {
+        break;
+      }
+      put(&s, done, strlen(done));
+    }
+  }
+
+  return s.pos;
+}
@@ -6,4 +6,115 @@
 // #define USE_GPS_UBLOX
 // #define USE_GPS_UNICORE
 
+/* RTCM CRC24Q 계산 방식 (1: 바이트 테이블, 4: slicing-by-4, 8: slicing-by-8) */
+#define RTCM_CRC24_SLICE_BY 4
+
+/* GPS 포트별 DMA 수신 순환 버퍼 크기
+ * HT/TC 인터럽트가 버퍼 절반마다 발생하므로, 태스크는 (크기 / 2) 바이트를
+ * 수신하는 시간 안에 한 번은 깨어나야 한다. 921600bps 기준 2048 = 약 11ms */
+#ifndef GPS_UART2_RX_BUF_SIZE
+#define GPS_UART2_RX_BUF_SIZE 2048
+#endif
+
+/* GPS 포트별 DMA 송신 링 버퍼 크기
+ * RTCM 보정 프레임(최대 1029바이트)을 통째로 담을 수 있어야 한다 */
+#ifndef GPS_UART2_TX_BUF_SIZE
+#define GPS_UART2_TX_BUF_SIZE 2048
+#endif
+
+/* GPS UART 보레이트
+ * 수신기는 GPS_UART_BOOT_BAUD로 부팅한다고 가정하고, 초기화 후
+ * GPS_UART_TARGET_BAUD로 전환한다 (UM982: CONFIG COM2, F9P: UBX-CFG-VALSET).
+ * 전환 후 정상 프레임이 들어오지 않으면 GPS_UART_PROBE_BAUDS를 순서대로 시도.
+ * GPS_UART_TARGET_BAUD를 GPS_UART_BOOT_BAUD와 같게 두면 전환하지 않는다 */
+#ifndef GPS_UART_BOOT_BAUD
+#define GPS_UART_BOOT_BAUD 38400
+#endif
+
+#ifndef GPS_UART_TARGET_BAUD
+#define GPS_UART_TARGET_BAUD 921600
+#endif
+
+#define GPS_UART_PROBE_BAUDS {921600, 460800, 230400, 115200, 38400, 9600}
+
+/* UM982에서 MCU USART2가 연결된 포트 */
+#define GPS_UM982_COM_PORT "COM2"
+
+#define GPS_BAUD_BOOT_TIMEOUT_MS 5000   // 부팅 후 첫 프레임 대기
+#define GPS_BAUD_SWITCH_DELAY_MS 50     // 전환 명령 전송 후 수신기 적용 대기
+#define GPS_BAUD_VERIFY_MS 1500         // 보레이트 변경 후 정상 프레임 대기
+#define GPS_BAUD_MAX_RETRY 3            // 탐색 성공 후 목표 보레이트 재전환 횟수
+
+/* 보레이트 확정 후 정상 프레임이 이 시간 동안 없으면 다시 탐색.
+ * 전환은 RAM 레이어에만 적용되므로 수신기 리셋/브라운아웃 후에는
+ * 부팅 보레이트로 돌아온다 */
+#define GPS_BAUD_LOST_MS 5000
+#define GPS_BAUD_LOST_CHECK_MS 1000     // 확정 상태에서 태스크가 깨어나는 주기
+
+/* 위치 이동 평균 윈도우 (샘플 수)
+ * GPS_AVG_WINDOW_MAX는 gps_avg_t 버퍼 크기, 나머지는 그 이하로 설정 */
+#ifndef GPS_AVG_WINDOW_MAX
+#define GPS_AVG_WINDOW_MAX 50
+#endif
+
+#ifndef GPS_GGA_AVG_WINDOW
+#define GPS_GGA_AVG_WINDOW 50
+#endif
+
+#ifndef GPS_HP_AVG_WINDOW
+#define GPS_HP_AVG_WINDOW 50
+#endif
+
+/* 베이스 좌표 측량 (survey-in)
+ * 베이스 보드에서 GPS 태스크 시작 시 측량을 시작하고, GPS_SURVEY_MIN_SAMPLES
+ * 이상 누적된 뒤 평균 정확도가 GPS_SURVEY_TARGET_ACC_MM 이하가 되면 완료.
+ * GPS_SURVEY_APPLY_FIXED가 1이면 완료 시 수신기를 고정 좌표 모드로 전환 */
+#ifndef GPS_SURVEY_ENABLE
+#define GPS_SURVEY_ENABLE 1
+#endif
+
+#ifndef GPS_SURVEY_APPLY_FIXED
+#define GPS_SURVEY_APPLY_FIXED 1
+#endif
+
+#define GPS_SURVEY_MIN_SAMPLES 1800       // 1Hz 기준 30분
+#define GPS_SURVEY_TARGET_ACC_MM 10
+#define GPS_SURVEY_MAX_DEV_M 50           // 기준점에서 이보다 먼 샘플은 버림
+#define GPS_SURVEY_MAX_REJECT_RUN 20      // 연속으로 버려지면 기준점부터 재시작
+#define GPS_SURVEY_MAX_SAMPLES 10000000UL // 이후로는 누적 중단 (int64 한계)
+
+/* GPS-UTC 윤초 (UBX iTOW를 NMEA UTC 시각과 맞출 때 사용) */
+#ifndef GPS_UTC_LEAP_SECONDS
+#define GPS_UTC_LEAP_SECONDS 18
+#endif
+
+/* 베이스 RTCM 출력 필터 (LoRa/NTRIP으로 내보내기 전)
+ * GPS_RTCM_FILTER_RULES에 없는 타입은 버리고 (화이트리스트), 간격이 있는
+ * 타입은 그 간격마다 한 번만 내보낸다 [ms, 0: 매번].
+ * GPS_RTCM_FILTER_GNSS_MASK에서 뺀 위성 시스템의 MSM/궤도력은 버린다 */
+#ifndef GPS_RTCM_MSM7_TO_MSM4
+#define GPS_RTCM_MSM7_TO_MSM4 1   // MSM7을 MSM4로 변환한 뒤 필터에 넣음 (약 40% 감소)
+#endif
+
+#ifndef GPS_RTCM_FILTER_ENABLE
+#define GPS_RTCM_FILTER_ENABLE 1
+#endif
+
+#define GPS_RTCM_FILTER_MAX_RULES 24
+#define GPS_RTCM_FILTER_JITTER_MS 100    // 출력 주기 흔들림 허용치
+
+#define GPS_RTCM_FILTER_RULES {                                              \
+  {1005, 10000}, {1006, 10000},   /* 기준국 좌표 */                           \
+  {1033, 60000},                  /* 수신기/안테나 기술자 */                  \
+  {1230, 10000},                  /* GLONASS 코드-위상 바이어스 */            \
+  {1074, 0}, {1077, 0},           /* GPS MSM4/7 */                           \
+  {1084, 0}, {1087, 0},           /* GLONASS MSM4/7 */                       \
+  {1094, 0}, {1097, 0},           /* Galileo MSM4/7 */                       \
+  {1124, 0}, {1127, 0},           /* BeiDou MSM4/7 */                        \
+}
+
+#define GPS_RTCM_FILTER_GNSS_MASK                                             \
+  (GPS_RTCM_GNSS_BIT(RTCM_GNSS_GPS) | GPS_RTCM_GNSS_BIT(RTCM_GNSS_GLONASS) |  \
+   GPS_RTCM_GNSS_BIT(RTCM_GNSS_GALILEO) | GPS_RTCM_GNSS_BIT(RTCM_GNSS_BEIDOU))
+
 #endif
\ No newline at end of file
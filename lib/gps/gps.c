@@ -5,7 +5,6 @@
 
 static inline void add_nmea_chksum(gps_t *gps, char ch);
 static inline uint8_t check_nmea_chksum(gps_t *gps);
-static inline void term_add(gps_t *gps, char ch);
 static inline void term_next(gps_t *gps);
 
 void _gps_gga_raw_add(gps_t *gps, char ch) {
@@ -15,20 +14,107 @@ void _gps_gga_raw_add(gps_t *gps, char ch) {
   }
 }
 
+/**
+ * @brief 최신 GGA 원문 복사
+ *
+ * 항법해 스냅샷에서 읽으므로 파서를 기다리지 않는다.
+ *
+ * @param[in] gps
+ * @param[out] buf 출력 버퍼 (100바이트 이상)
+ * @param[out] len 원문 길이
+ * @return true: 유효한 GGA 있음
+ */
 bool get_gga(gps_t *gps, char* buf, uint8_t* len)
 {
-  bool ret = false;
+#if defined(USE_STORE_RAW_GGA)
+  gps_nav_t nav;
+
+  if(gps_get_nav(gps, &nav) && nav.gga_valid && nav.gga_raw_len > 0 &&
+     nav.gga.fix != GPS_FIX_INVALID)
+  {
+    memcpy(buf, nav.gga_raw, nav.gga_raw_len + 1);
+    *len = nav.gga_raw_len;
+    return true;
+  }
+#endif
+
+  return false;
+}
+
+/**
+ * @brief 최신 항법해 게시 (파서 컨텍스트)
+ *
+ * @param[inout] gps
+ * @param[in] protocol 갱신된 메시지의 프로토콜
+ */
+void _gps_nav_publish(gps_t *gps, gps_procotol_t protocol)
+{
+  gps_nav_snapshot_t *nav = &gps->nav;
+  uint8_t idx = nav->active ^ 1;
+  gps_nav_t *dst = &nav->buf[idx];
+
+  if(protocol == GPS_PROTOCOL_NMEA) {
+    nav->gga_valid = true;
+  } else if(protocol == GPS_PROTOCOL_UBX) {
+    nav->hp_valid = true;
+  }
+
+  nav->seq[idx]++;
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  dst->epoch = ++nav->epoch;
+  dst->tick = xTaskGetTickCount();
+  dst->gga_valid = nav->gga_valid;
+  dst->gga = gps->nmea_data.gga;
+#if defined(USE_STORE_RAW_GGA)
+  if(gps->nmea_data.gga_is_rdy) {
+    memcpy(dst->gga_raw, gps->nmea_data.gga_raw, gps->nmea_data.gga_raw_pos + 1);
+    dst->gga_raw_len = gps->nmea_data.gga_raw_pos;
+  } else {
+    dst->gga_raw[0] = '\0';
+    dst->gga_raw_len = 0;
+  }
+#endif
+  dst->hp_valid = nav->hp_valid;
+  dst->hpposllh = gps->ubx_data.hpposllh;
+  dst->sol = gps->sol.out;
+
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  nav->seq[idx]++;
+  nav->active = idx;
+}
+
+/**
+ * @brief 최신 항법해 복사 (잠금 없음, 어느 태스크에서나 호출 가능)
+ *
+ * @param[in] gps
+ * @param[out] nav 출력
+ * @return true: 게시된 항법해 있음
+ */
+bool gps_get_nav(const gps_t *gps, gps_nav_t *nav)
+{
+  const gps_nav_snapshot_t *snap = &gps->nav;
 
-  xSemaphoreTake(gps->mutex, portMAX_DELAY);
-  if(gps->nmea_data.gga_is_rdy && gps->nmea_data.gga.fix != GPS_FIX_INVALID)
+  for(;;)
   {
-    strncpy(buf, gps->nmea_data.gga_raw, gps->nmea_data.gga_raw_pos + 1);
-    *len = gps->nmea_data.gga_raw_pos;
-    ret = true;
+    uint8_t idx = snap->active;
+    uint32_t seq = snap->seq[idx];
+
+    if(seq & 1) {
+      // 그 사이 두 번 게시되어 이 버퍼를 쓰는 중, active는 이미 다른 버퍼
+      continue;
+    }
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    memcpy(nav, (const void *)&snap->buf[idx], sizeof(*nav));
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    if(snap->seq[idx] == seq) {
+      break;
+    }
   }
-  xSemaphoreGive(gps->mutex);
 
-  return ret;
+  return nav->epoch != 0;
 }
 
 /**
@@ -61,32 +147,6 @@ static inline uint8_t check_nmea_chksum(gps_t *gps) {
   return 1;
 }
 
-/**
- * @brief 프로토콜 페이로드 추가
- *
- * @param[inout] gps
- * @param[in] ch
- */
-static inline void add_payload(gps_t *gps, char ch) {
-  if (gps->pos < GPS_PAYLOAD_SIZE - 1) {
-    gps->payload[gps->pos] = ch;
-    gps->payload[++gps->pos] = 0;
-  }
-}
-
-/**
- * @brief NMEA183 프로토콜 , 사이에 있는 문자 추가
- *
- * @param[inout] gps
- * @param[in] ch
- */
-static inline void term_add(gps_t *gps, char ch) {
-  if (gps->nmea.term_pos < GPS_NMEA_TERM_SIZE - 1) {
-    gps->nmea.term_str[gps->nmea.term_pos] = ch;
-    gps->nmea.term_str[++gps->nmea.term_pos] = 0;
-  }
-}
-
 /**
  * @brief NMEA183 프로토콜 , 파싱후 초기화
  *
@@ -138,15 +198,398 @@ static bool check_for_rdy(const uint8_t *data, size_t len) {
 //   return false;
 // }
 
+/**
+ * @brief 프레임 시작 바이트 테이블 ('$', UBX 0xB5, RTCM 0xD3, Unicore 0xAA)
+ */
+static const uint8_t sync_tbl[256] = {
+  ['$'] = 1,
+  [0xB5] = 1,
+  [RTCM3_PREAMBLE] = 1,
+  [GPS_UNICORE_BIN_SYNC_1] = 1,
+};
+
+/**
+ * @brief NMEA/Unicore ASCII 구분자 테이블
+ */
+static const uint8_t delim_tbl[256] = {
+  ['$'] = 1,
+  [','] = 1,
+  ['*'] = 1,
+  ['\r'] = 1,
+};
+
+/**
+ * @brief 테이블에 표시된 바이트가 처음 나오는 위치 검색
+ *
+ * @param[in] tbl
+ * @param[in] d
+ * @param[in] len
+ * @return size_t 찾은 위치, 없으면 len
+ */
+static inline size_t find_byte(const uint8_t *tbl, const uint8_t *d, size_t len) {
+  size_t i = 0;
+
+  while (i < len && !tbl[d[i]]) {
+    i++;
+  }
+
+  return i;
+}
+
+/**
+ * @brief GGA 원본 문자열 블록 추가
+ *
+ * @param[inout] gps
+ * @param[in] d
+ * @param[in] len
+ */
+static inline void gga_raw_add_block(gps_t *gps, const uint8_t *d, size_t len) {
+#if defined(USE_STORE_RAW_GGA)
+  size_t space = 99 - gps->nmea_data.gga_raw_pos;
+
+  if (len > space) {
+    len = space;
+  }
+
+  memcpy(&gps->nmea_data.gga_raw[gps->nmea_data.gga_raw_pos], d, len);
+  gps->nmea_data.gga_raw_pos += len;
+  gps->nmea_data.gga_raw[gps->nmea_data.gga_raw_pos] = '\0';
+#endif
+}
+
+/**
+ * @brief 구분자 사이 문자들을 term 버퍼에 한번에 추가
+ *
+ * @param[inout] term_str
+ * @param[inout] term_pos
+ * @param[in] size term 버퍼 크기
+ * @param[inout] crc
+ * @param[in] star '*' 이후면 체크섬 누적 안 함
+ * @param[in] d
+ * @param[in] len
+ */
+static inline void term_add_block(char *term_str, uint8_t *term_pos, size_t size,
+                                  uint8_t *crc, uint8_t star,
+                                  const uint8_t *d, size_t len) {
+  size_t n = size - 1 - *term_pos;
+
+  if (!star) {
+    for (size_t i = 0; i < len; i++) {
+      *crc ^= d[i];
+    }
+  }
+
+  if (n > len) {
+    n = len;
+  }
+
+  memcpy(&term_str[*term_pos], d, n);
+  *term_pos += n;
+  term_str[*term_pos] = 0;
+}
+
+/**
+ * @brief 프로토콜 미확정 상태: sync 바이트 검색
+ *
+ * @param[inout] gps
+ * @param[in] d
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
+ */
+static size_t parse_sync(gps_t *gps, const uint8_t *d, size_t len) {
+  size_t i;
+
+  /* 청크 경계에 걸친 멀티바이트 sync */
+  if (gps->state == GPS_PARSE_STATE_UBX_SYNC_1) {
+    gps->state = GPS_PARSE_STATE_NONE;
+
+    if (*d == 0x62) {
+      memset(gps->payload, 0, sizeof(gps->payload));
+      memset(&gps->ubx, 0, sizeof(gps->ubx));
+      gps->pos = 0;
+
+      gps->protocol = GPS_PROTOCOL_UBX;
+      gps->state = GPS_PARSE_STATE_UBX_SYNC_2;
+      return 1;
+    }
+  } else if (gps->state == GPS_PARSE_STATE_UNICORE_BIN_SYNC_1) {
+    gps->state = GPS_PARSE_STATE_NONE;
+
+    if (*d == GPS_UNICORE_BIN_SYNC_2) {
+      gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_2;
+      gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_2;
+      return 1;
+    }
+  } else if (gps->state == GPS_PARSE_STATE_UNICORE_BIN_SYNC_2) {
+    gps->state = GPS_PARSE_STATE_NONE;
+
+    if (*d == GPS_UNICORE_BIN_SYNC_3) {
+      gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_3;
+      memset(&gps->unicore_bin, 0, sizeof(gps->unicore_bin));
+      gps->protocol = GPS_PROTOCOL_UNICORE;
+      gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_3;
+      return 1;
+    }
+  }
+
+  /* sync 바이트가 아닌 구간은 한번에 건너뜀 */
+  i = find_byte(sync_tbl, d, len);
+  if (i > 0) {
+    return i;
+  }
+
+  switch (*d) {
+  case '$':
+    memset(&gps->nmea, 0, sizeof(gps->nmea));
+    // 첫 term에서 NMEA / UNICORE ASCII 판단
+    gps->protocol = GPS_PROTOCOL_NMEA;
+    gps->state = GPS_PARSE_STATE_NMEA_START;
+    break;
+
+  case GPS_UNICORE_BIN_SYNC_1:
+    gps->pos = 0;
+    gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_1;
+    gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_1;
+    break;
+
+  case 0xB5:
+    gps->state = GPS_PARSE_STATE_UBX_SYNC_1;
+    break;
+
+  case RTCM3_PREAMBLE:
+    // 0xD3 부터 RTCM 파서에 전달
+    rtcm_parser_reset(&gps->rtcm);
+    gps->protocol = GPS_PROTOCOL_RTCM;
+    gps->state = GPS_PARSE_STATE_RTCM_PARSING;
+    return 0;
+
+  default:
+    break;
+  }
+
+  return 1;
+}
+
+/**
+ * @brief NMEA 183 블록 파싱
+ *
+ * @param[inout] gps
+ * @param[in] d
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
+ */
+static size_t parse_nmea(gps_t *gps, const uint8_t *d, size_t len) {
+  size_t i = find_byte(delim_tbl, d, len);
+
+  if (gps->nmea.msg_type == GPS_NMEA_MSG_GGA) {
+    gga_raw_add_block(gps, d, i < len && d[i] != '$' ? i + 1 : i);
+  }
+
+  if (i > 0) {
+    term_add_block(gps->nmea.term_str, &gps->nmea.term_pos, GPS_NMEA_TERM_SIZE,
+                   &gps->nmea.crc, gps->nmea.star, d, i);
+  }
+
+  if (i == len) {
+    return i;
+  }
+
+  switch (d[i]) {
+  case ',':
+    // 첫 term에서 프로토콜 확인
+    if (gps->state == GPS_PARSE_STATE_NMEA_START &&
+        (!strncmp(gps->nmea.term_str, "command", 7) ||
+         !strncmp(gps->nmea.term_str, "config", 6))) {
+      // UNICORE 프로토콜로 전환
+      memcpy(gps->unicore.term_str, gps->nmea.term_str, GPS_NMEA_TERM_SIZE);
+      gps->unicore.term_pos = gps->nmea.term_pos;
+      gps->unicore.term_num = 0;
+      gps->unicore.msg_type = GPS_UNICORE_MSG_NONE;
+      gps->unicore.star = 0;
+      gps->unicore.crc = 0;
+
+      gps->protocol = GPS_PROTOCOL_UNICORE;
+      gps->state = GPS_PARSE_STATE_UNICORE_START;
+
+      // UNICORE term 파싱
+      gps_parse_unicore_term(gps);
+      gps->unicore.crc ^= (uint8_t)',';
+      gps->unicore.term_str[0] = 0;
+      gps->unicore.term_pos = 0;
+      gps->unicore.term_num++;
+    } else {
+      gps_parse_nmea_term(gps);
+      add_nmea_chksum(gps, ',');
+      term_next(gps);
+    }
+    break;
+
+  case '*':
+    gps_parse_nmea_term(gps);
+    gps->nmea.star = 1;
+    term_next(gps);
+
+    gps->state = GPS_PARSE_STATE_NMEA_CHKSUM;
+    break;
+
+  case '\r':
+#if defined(USE_STORE_RAW_GGA)
+    // 핸들러에서 완성된 GGA 원문을 쓸 수 있도록 이벤트 전에 마무리
+    if(gps->nmea.msg_type == GPS_NMEA_MSG_GGA)
+    {
+        _gps_gga_raw_add(gps, '\n');
+        gps->nmea_data.gga_is_rdy = true;
+    }
+#endif
+    if (check_nmea_chksum(gps)) {
+      gps_msg_t msg;
+      msg.nmea = gps->nmea.msg_type;
+
+      if(msg.nmea == GPS_NMEA_MSG_GGA)
+      {
+        _gps_nav_publish(gps, GPS_PROTOCOL_NMEA);
+        gps_nmea_merge_gga(gps);
+      }
+
+      if(gps->handler)
+      {
+        gps->handler(gps, GPS_EVENT_NONE, GPS_PROTOCOL_NMEA, msg);
+      }
+    }
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+    break;
+
+  default:
+    // '$': 문장이 끝나기 전에 새 문장 시작, sync 부터 다시 처리
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+    return i;
+  }
+
+  return i + 1;
+}
+
+/**
+ * @brief UNICORE ASCII 블록 파싱 (NMEA와 유사한 구조)
+ *
+ * @param[inout] gps
+ * @param[in] d
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
+ */
+static size_t parse_unicore_ascii(gps_t *gps, const uint8_t *d, size_t len) {
+  size_t i = find_byte(delim_tbl, d, len);
+
+  if (i > 0) {
+    term_add_block(gps->unicore.term_str, &gps->unicore.term_pos, GPS_UNICORE_TERM_SIZE,
+                   &gps->unicore.crc, gps->unicore.star, d, i);
+  }
+
+  if (i == len) {
+    return i;
+  }
+
+  switch (d[i]) {
+  case ',':
+    gps_parse_unicore_term(gps);
+    gps->unicore.crc ^= (uint8_t)',';
+    gps->unicore.term_str[0] = 0;
+    gps->unicore.term_pos = 0;
+    gps->unicore.term_num++;
+    break;
+
+  case '*':
+    gps_parse_unicore_term(gps);
+    gps->unicore.star = 1;
+    gps->unicore.term_str[0] = 0;
+    gps->unicore.term_pos = 0;
+    gps->unicore.term_num++;
+
+    gps->state = GPS_PARSE_STATE_UNICORE_CHKSUM;
+    break;
+
+  case '\r': {
+    // 체크섬 확인
+    uint8_t crc = 0;
+    if (gps->unicore.term_pos >= 2) {
+      crc = (uint8_t)((((PARSER_CHAR_HEX_TO_NUM(gps->unicore.term_str[0])) & 0x0FU) << 0x04U) |
+                      ((PARSER_CHAR_HEX_TO_NUM(gps->unicore.term_str[1])) & 0x0FU));
+    }
+
+    if (gps->unicore.crc == crc) {
+      // 응답 파싱 완료
+      gps_msg_t msg = {0};
+
+      // 이벤트 발생
+      if (gps->handler) {
+        if (gps->unicore_data.last_response == GPS_UNICORE_RESP_OK) {
+          gps->handler(gps, GPS_EVENT_ACK_OK, GPS_PROTOCOL_UNICORE, msg);
+        } else if (gps->unicore_data.last_response == GPS_UNICORE_RESP_ERROR) {
+          gps->handler(gps, GPS_EVENT_ACK_FAIL, GPS_PROTOCOL_UNICORE, msg);
+        }
+      }
+    }
+
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+    break;
+  }
+
+  default:
+    // '$': 새 문장 시작
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+    return i;
+  }
+
+  return i + 1;
+}
+
+/**
+ * @brief RTCM 블록 파싱
+ *
+ * @param[inout] gps
+ * @param[in] d
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
+ */
+static size_t parse_rtcm(gps_t *gps, const uint8_t *d, size_t len) {
+  size_t n = 0;
+
+  if (rtcm_parse_block(&gps->rtcm, d, len, &n)) {
+    if (gps->handler) {
+      gps_msg_t msg = {0};
+      gps->handler(gps, GPS_EVENT_RTCM_PACKET, GPS_PROTOCOL_RTCM, msg);
+    }
+
+    // 다음 패킷을 위해 리셋
+    rtcm_parser_reset(&gps->rtcm);
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+  } else if (gps->rtcm.current_packet.state == RTCM_PARSE_STATE_IDLE) {
+    // 길이/CRC 오류, sync 부터 다시 찾음
+    gps->protocol = GPS_PROTOCOL_NONE;
+    gps->state = GPS_PARSE_STATE_NONE;
+  }
+
+  return n;
+}
+
 /**
  * @brief GPS 프로토콜 파싱
  *
+ * DMA 청크 단위로 처리한다. sync 바이트와 구분자는 테이블 검색으로 한번에
+ * 찾고, 길이가 정해진 바이너리 프레임(UBX, RTCM, Unicore)은 블록 복사한다.
+ * 청크 경계에 걸친 프레임은 파서 상태에 남겨두고 다음 청크에서 이어서 처리한다.
+ *
  * @param[inout] gps
  * @param[in] data
  * @param[in] len
  */
 void gps_parse_process(gps_t *gps, const void *data, size_t len) {
   const uint8_t *d = data;
+  size_t n;
 
   // 초기화 중: RDY 대기
   if (gps->init_state == GPS_INIT_WAIT_READY) {
@@ -160,222 +603,59 @@ void gps_parse_process(gps_t *gps, const void *data, size_t len) {
     }
   }
 
-  for (; len > 0; ++d, --len) {
-    /* @TODO GPS_PROTOCOL_NONE 일때 start 문자 찾는걸 만들고, 프로토콜에 따라
-     * 다르게 파싱하게끔 만들기 */
-    if (gps->protocol == GPS_PROTOCOL_NONE) {
-      if (*d == '$') {
-        // $ 다음 문자들을 확인하기 위해 임시 상태로
-        gps->state = GPS_PARSE_STATE_NMEA_START;
-
-        // NMEA 파서 초기화 (임시)
-        memset(gps->nmea.term_str, 0, sizeof(gps->nmea.term_str));
-        gps->nmea.term_pos = 0;
-        gps->nmea.term_num = 0;
-        memset(&gps->nmea, 0, sizeof(gps->nmea));
-
-        // 아직 프로토콜 확정 안 함 (term에서 판단)
-      } else if (*d == GPS_UNICORE_BIN_SYNC_1) {  // 0xAA
-        // Payload 초기화 및 첫 sync 바이트 저장
-        memset(gps->payload, 0, sizeof(gps->payload));
-        gps->pos = 0;
-        gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_1;
-        gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_1;
-      } else if (*d == GPS_UNICORE_BIN_SYNC_2 && gps->state == GPS_PARSE_STATE_UNICORE_BIN_SYNC_1) {  // 0x44
-        gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_2;
-        gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_2;
-      } else if (*d == GPS_UNICORE_BIN_SYNC_3 && gps->state == GPS_PARSE_STATE_UNICORE_BIN_SYNC_2) {  // 0x12
-        gps->payload[gps->pos++] = GPS_UNICORE_BIN_SYNC_3;
-        memset(&gps->unicore_bin, 0, sizeof(gps->unicore_bin));
-        gps->protocol = GPS_PROTOCOL_UNICORE;
-        gps->state = GPS_PARSE_STATE_UNICORE_BIN_SYNC_3;
-      } else if (*d == 0xB5) {
-        gps->state = GPS_PARSE_STATE_UBX_SYNC_1;
-      } else if (*d == 0x62 && gps->state == GPS_PARSE_STATE_UBX_SYNC_1) {
-        memset(gps->payload, 0, sizeof(gps->payload));
-        memset(&gps->ubx, 0, sizeof(gps->ubx));
-        gps->pos = 0;
-
-        gps->protocol = GPS_PROTOCOL_UBX;
-        gps->state = GPS_PARSE_STATE_UBX_SYNC_2;
-      } else if (*d == RTCM3_PREAMBLE) {
-        // RTCM 패킷 시작 (0xD3)
-        gps->protocol = GPS_PROTOCOL_RTCM;
-        gps->state = GPS_PARSE_STATE_RTCM_PARSING;
-
-        // RTCM 파서에 첫 바이트 전달
-        if (rtcm_parse_byte(&gps->rtcm, *d)) {
-          // 패킷 완성 (거의 불가능하지만 체크)
-          const uint8_t *packet_data = NULL;
-          uint16_t packet_len = 0;
-          rtcm_get_packet(&gps->rtcm, &packet_data, &packet_len);
-
-          if (packet_data && gps->handler) {
-            gps_msg_t msg = {0};
-            gps->handler(gps, GPS_EVENT_RTCM_PACKET, GPS_PROTOCOL_RTCM, msg);
-          }
-
-          rtcm_parser_reset(&gps->rtcm);
-          gps->protocol = GPS_PROTOCOL_NONE;
-          gps->state = GPS_PARSE_STATE_NONE;
-        }
-      } else {
-        gps->state = GPS_PARSE_STATE_NONE;
-      }
-    } else if (gps->protocol == GPS_PROTOCOL_NMEA) {
-      if(gps->nmea.msg_type == GPS_NMEA_MSG_GGA)
-      {
-          _gps_gga_raw_add(gps, *d);
-      }
+  while (len > 0) {
+    switch (gps->protocol) {
+    case GPS_PROTOCOL_NMEA:
+      n = parse_nmea(gps, d, len);
+      break;
 
-      if (*d == ',') {
-        // 첫 term에서 프로토콜 확인
-        if (gps->state == GPS_PARSE_STATE_NMEA_START) {
-          // "command" 또는 "config"인지 확인
-          if (!strncmp(gps->nmea.term_str, "command", 7) ||
-              !strncmp(gps->nmea.term_str, "config", 6)) {
-            // UNICORE 프로토콜로 전환
-            memcpy(gps->unicore.term_str, gps->nmea.term_str, GPS_NMEA_TERM_SIZE);
-            gps->unicore.term_pos = gps->nmea.term_pos;
-            gps->unicore.term_num = 0;
-            gps->unicore.msg_type = GPS_UNICORE_MSG_NONE;
-            gps->unicore.star = 0;
-            gps->unicore.crc = 0;
-
-            gps->protocol = GPS_PROTOCOL_UNICORE;
-            gps->state = GPS_PARSE_STATE_UNICORE_START;
-
-            // UNICORE term 파싱
-            gps_parse_unicore_term(gps);
-            gps->unicore.crc ^= (uint8_t)',';
-            gps->unicore.term_str[0] = 0;
-            gps->unicore.term_pos = 0;
-            gps->unicore.term_num++;
-          } else {
-            // NMEA 프로토콜 확정
-            gps->protocol = GPS_PROTOCOL_NMEA;
-            gps_parse_nmea_term(gps);
-            add_nmea_chksum(gps, *d);
-            term_next(gps);
-          }
-        } else {
-          gps_parse_nmea_term(gps);
-          add_nmea_chksum(gps, *d);
-          term_next(gps);
-        }
-      } else if (*d == '*') {
-        gps_parse_nmea_term(gps);
-        gps->nmea.star = 1;
-        term_next(gps);
-
-        gps->state = GPS_PARSE_STATE_NMEA_CHKSUM;
-      } else if (*d == '\r') {
-        if (check_nmea_chksum(gps)) {
-          gps_msg_t msg;
-          msg.nmea = gps->nmea.msg_type;
-
-          if(gps->handler)
-          {
-            gps->handler(gps, GPS_EVENT_NONE, GPS_PROTOCOL_NMEA, msg);
-          }
-        }
-#if defined(USE_STORE_RAW_GGA)
-        if(gps->nmea.msg_type == GPS_NMEA_MSG_GGA)
-        {
-            _gps_gga_raw_add(gps, *d);
-            _gps_gga_raw_add(gps, '\n');
-            gps->nmea_data.gga_is_rdy = true;
-        }
-#endif
-        gps->protocol = GPS_PROTOCOL_NONE;
-        gps->state = GPS_PARSE_STATE_NONE;
-      } else {
-        if (!gps->nmea.star) {
-          add_nmea_chksum(gps, *d);
-        }
-        term_add(gps, *d);
-      }
-    } else if (gps->protocol == GPS_PROTOCOL_UBX) {
-      add_payload(gps, *d);
-      gps_parse_ubx(gps);
-    } else if (gps->protocol == GPS_PROTOCOL_RTCM) {
-      // RTCM 바이트 단위 파싱
-      if (rtcm_parse_byte(&gps->rtcm, *d)) {
-        // RTCM 패킷 파싱 완료
-        const uint8_t *packet_data = NULL;
-        uint16_t packet_len = 0;
-        rtcm_get_packet(&gps->rtcm, &packet_data, &packet_len);
-
-        if (packet_data && gps->handler) {
-          gps_msg_t msg = {0};
-          gps->handler(gps, GPS_EVENT_RTCM_PACKET, GPS_PROTOCOL_RTCM, msg);
-        }
+    case GPS_PROTOCOL_UBX:
+      n = gps_parse_ubx(gps, d, len);
+      break;
 
-        // 다음 패킷을 위해 리셋
-        rtcm_parser_reset(&gps->rtcm);
-        gps->protocol = GPS_PROTOCOL_NONE;
-        gps->state = GPS_PARSE_STATE_NONE;
-      }
-    } else if (gps->protocol == GPS_PROTOCOL_UNICORE) {
-      // UNICORE 바이너리 파싱
+    case GPS_PROTOCOL_RTCM:
+      n = parse_rtcm(gps, d, len);
+      break;
+
+    case GPS_PROTOCOL_UNICORE:
       if (gps->state >= GPS_PARSE_STATE_UNICORE_BIN_SYNC_3 &&
           gps->state <= GPS_PARSE_STATE_UNICORE_BIN_CRC) {
-        add_payload(gps, *d);
-        gps_parse_unicore_bin(gps);
+        n = gps_parse_unicore_bin(gps, d, len);
+      } else {
+        n = parse_unicore_ascii(gps, d, len);
       }
-      // UNICORE ASCII 프로토콜 파싱 (NMEA와 유사한 구조)
-      else if (*d == ',') {
-        gps_parse_unicore_term(gps);
-        gps->unicore.crc ^= (uint8_t)*d;
-        gps->unicore.term_str[0] = 0;
-        gps->unicore.term_pos = 0;
-        gps->unicore.term_num++;
-      } else if (*d == '*') {
-        gps_parse_unicore_term(gps);
-        gps->unicore.star = 1;
-        gps->unicore.term_str[0] = 0;
-        gps->unicore.term_pos = 0;
-        gps->unicore.term_num++;
-
-        gps->state = GPS_PARSE_STATE_UNICORE_CHKSUM;
-      } else if (*d == '\r') {
-        // 체크섬 확인
-        uint8_t crc = 0;
-        if (gps->unicore.term_pos >= 2) {
-          crc = (uint8_t)((((PARSER_CHAR_HEX_TO_NUM(gps->unicore.term_str[0])) & 0x0FU) << 0x04U) |
-                          ((PARSER_CHAR_HEX_TO_NUM(gps->unicore.term_str[1])) & 0x0FU));
-        }
+      break;
 
-        if (gps->unicore.crc == crc) {
-          // 응답 파싱 완료
-          gps_msg_t msg = {0};
-
-          // 이벤트 발생
-          if (gps->handler) {
-            if (gps->unicore_data.last_response == GPS_UNICORE_RESP_OK) {
-              gps->handler(gps, GPS_EVENT_ACK_OK, GPS_PROTOCOL_UNICORE, msg);
-            } else if (gps->unicore_data.last_response == GPS_UNICORE_RESP_ERROR) {
-              gps->handler(gps, GPS_EVENT_ACK_FAIL, GPS_PROTOCOL_UNICORE, msg);
-            }
-          }
-        }
-
-        gps->protocol = GPS_PROTOCOL_NONE;
-        gps->state = GPS_PARSE_STATE_NONE;
-      } else {
-        if (!gps->unicore.star) {
-          gps->unicore.crc ^= (uint8_t)*d;
-        }
+    case GPS_PROTOCOL_NONE:
+      n = parse_sync(gps, d, len);
+      break;
 
-        if (gps->unicore.term_pos < GPS_UNICORE_TERM_SIZE - 1) {
-          gps->unicore.term_str[gps->unicore.term_pos] = *d;
-          gps->unicore.term_str[++gps->unicore.term_pos] = 0;
-        }
-      }
+    default:
+      gps->protocol = GPS_PROTOCOL_NONE;
+      gps->state = GPS_PARSE_STATE_NONE;
+      n = 0;
+      break;
     }
+
+    d += n;
+    len -= n;
   }
 }
 
+/**
+ * @brief 파서 상태 초기화 (수신 데이터 유실 후 재동기)
+ *
+ * 진행 중이던 프레임을 버리고 다음 sync 바이트부터 다시 찾는다.
+ * 파싱된 데이터(nmea_data, ubx_data 등)는 유지한다.
+ *
+ * @param[inout] gps
+ */
+void gps_parse_reset(gps_t *gps) {
+  gps->protocol = GPS_PROTOCOL_NONE;
+  gps->state = GPS_PARSE_STATE_NONE;
+  gps->pos = 0;
+  rtcm_parser_reset(&gps->rtcm);
+}
 
 void gps_set_evt_handler(gps_t* gps, evt_handler handler)
 {
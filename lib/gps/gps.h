@@ -10,21 +10,25 @@
 #include "gps_ubx.h"
 #include "gps_unicore.h"
 #include "rtcm.h"
+#include "gps_solution.h"
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <stdbool.h>
 
-#define GPS_PAYLOAD_SIZE 256
+/* UBX NAV-SAT (8 + 12 * 위성 수) 프레임까지 담을 수 있는 크기 */
+#define GPS_PAYLOAD_SIZE 1024
 
 typedef struct {
   int (*init)(void);
   int (*start)(void);
   int (*stop)(void);
   int (*reset)(void);
-  int (*send)(const char *data, size_t len);
+  int (*send)(const char *data, size_t len);       // 전송 완료까지 대기
+  int (*send_async)(const char *data, size_t len); // 송신 링에 넣고 즉시 반환
   int (*recv)(char *buf, size_t len);
+  int (*set_baud)(uint32_t baud);
 } gps_hal_ops_t;
 
 typedef void (*evt_handler)(gps_t* gps, gps_event_t event, gps_procotol_t protocol, gps_msg_t msg);
@@ -35,6 +39,41 @@ typedef enum {
   GPS_INIT_WAIT_ACK,          // ACK 대기
   GPS_INIT_DONE               // 초기화 완료
 } gps_init_state_t;
+/**
+ * @brief 최신 항법해 스냅샷
+ *
+ * GGA, HPPOSLLH 수신 시점에 파서가 게시한다.
+ */
+typedef struct {
+  uint32_t epoch;         // 게시 번호 (0: 아직 없음)
+  TickType_t tick;        // 게시 시각
+  bool gga_valid;         // GGA 수신됨
+  gps_gga_t gga;
+#if defined(USE_STORE_RAW_GGA)
+  char gga_raw[100];
+  uint8_t gga_raw_len;    // 0: 원문 없음
+#endif
+  bool hp_valid;          // HPPOSLLH 수신됨
+  gps_ubx_nav_hpposllh_t hpposllh;
+  gps_solution_t sol;     // 마지막 통합 항법해 (sol.epoch 0: 없음)
+} gps_nav_t;
+
+/**
+ * @brief 항법해 이중 버퍼 (seqlock)
+ *
+ * 쓰기(파서)는 비활성 버퍼에 쓴 뒤 active를 바꾸고, 읽기는 active 버퍼를
+ * 복사한 후 seq가 그대로인지 확인한다. 쓰기는 기다리지 않고, 읽기는
+ * 복사 도중 버퍼가 다시 쓰였을 때만 재시도한다.
+ */
+typedef struct {
+  gps_nav_t buf[2];
+  volatile uint32_t seq[2];  // 홀수: 쓰는 중
+  volatile uint8_t active;
+  uint32_t epoch;
+  bool gga_valid;
+  bool hp_valid;
+} gps_nav_snapshot_t;
+
 /**
  * @brief GPS 구조체
  *
@@ -67,17 +106,26 @@ typedef struct gps_s {
   gps_ubx_data_t ubx_data;
   gps_unicore_data_t unicore_data;
 
+  /* 통합 항법해 병합 */
+  gps_sol_ctx_t sol;
+
+  /* 최신 항법해 (잠금 없이 읽기) */
+  gps_nav_snapshot_t nav;
+
   /* evt handler */
   evt_handler handler;
 } gps_t;
 
 void gps_init(gps_t *gps);
 void gps_parse_process(gps_t *gps, const void *data, size_t len);
+void gps_parse_reset(gps_t *gps);
 void gps_set_evt_handler(gps_t *gps, evt_handler handler);
 
 bool get_gga(gps_t *gps, char* buf, uint8_t* len);
+bool gps_get_nav(const gps_t *gps, gps_nav_t *nav);
 
 /* internal */
 void _gps_gga_raw_add(gps_t *gps, char ch);
+void _gps_nav_publish(gps_t *gps, gps_procotol_t protocol);
 
 #endif
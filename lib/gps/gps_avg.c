@@ -0,0 +1,136 @@
+#include "gps_avg.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * @brief 버퍼에서 합/제곱합 다시 계산
+ *
+ * 기준값을 현재 평균으로 옮기고 저장된 편차도 같이 보정한다.
+ *
+ * @param avg 이동 평균
+ */
+static void gps_avg_resync(gps_avg_t *avg) {
+  for (uint8_t c = 0; c < avg->ch; c++) {
+    double shift = avg->sum[c] / (double)avg->len;
+    double sum = 0.0, sq_sum = 0.0;
+
+    for (uint16_t i = 0; i < avg->len; i++) {
+      double d = avg->buf[i][c] - shift;
+
+      avg->buf[i][c] = d;
+      sum += d;
+      sq_sum += d * d;
+    }
+
+    avg->ref[c] += shift;
+    avg->sum[c] = sum;
+    avg->sq_sum[c] = sq_sum;
+  }
+}
+
+/**
+ * @brief 이동 평균 초기화
+ */
+void gps_avg_init(gps_avg_t *avg, uint8_t ch, uint16_t window) {
+  if (ch == 0) {
+    ch = 1;
+  } else if (ch > GPS_AVG_CH_MAX) {
+    ch = GPS_AVG_CH_MAX;
+  }
+
+  avg->ch = ch;
+  gps_avg_set_window(avg, window);
+}
+
+/**
+ * @brief 누적된 샘플 버리기
+ */
+void gps_avg_reset(gps_avg_t *avg) {
+  memset(avg->ref, 0, sizeof(avg->ref));
+  memset(avg->sum, 0, sizeof(avg->sum));
+  memset(avg->sq_sum, 0, sizeof(avg->sq_sum));
+  avg->pos = 0;
+  avg->len = 0;
+}
+
+/**
+ * @brief 윈도우 크기 변경
+ */
+void gps_avg_set_window(gps_avg_t *avg, uint16_t window) {
+  if (window == 0) {
+    window = 1;
+  } else if (window > GPS_AVG_WINDOW_MAX) {
+    window = GPS_AVG_WINDOW_MAX;
+  }
+
+  avg->window = window;
+  gps_avg_reset(avg);
+}
+
+/**
+ * @brief 샘플 추가
+ */
+void gps_avg_add(gps_avg_t *avg, const double *val) {
+  uint16_t pos = avg->pos;
+  bool full = (avg->len == avg->window);
+
+  if (avg->len == 0) {
+    // 첫 샘플을 기준값으로 삼아 편차를 작게 유지
+    for (uint8_t c = 0; c < avg->ch; c++) {
+      avg->ref[c] = val[c];
+    }
+  }
+
+  for (uint8_t c = 0; c < avg->ch; c++) {
+    double d = val[c] - avg->ref[c];
+
+    if (full) {
+      double old = avg->buf[pos][c];
+
+      avg->sum[c] -= old;
+      avg->sq_sum[c] -= old * old;
+    }
+
+    avg->buf[pos][c] = d;
+    avg->sum[c] += d;
+    avg->sq_sum[c] += d * d;
+  }
+
+  if (!full) {
+    avg->len++;
+  }
+
+  avg->pos = (pos + 1) % avg->window;
+
+  // 윈도우 한 바퀴마다 정확히 다시 계산 (샘플당 평균 O(1))
+  if (avg->pos == 0) {
+    gps_avg_resync(avg);
+  }
+}
+
+/**
+ * @brief 채널 평균
+ */
+double gps_avg_mean(const gps_avg_t *avg, uint8_t ch) {
+  if (avg->len == 0 || ch >= avg->ch) {
+    return 0.0;
+  }
+
+  return avg->ref[ch] + avg->sum[ch] / (double)avg->len;
+}
+
+/**
+ * @brief 채널 표준편차
+ */
+double gps_avg_stddev(const gps_avg_t *avg, uint8_t ch) {
+  double mean, var;
+
+  if (avg->len == 0 || ch >= avg->ch) {
+    return 0.0;
+  }
+
+  mean = avg->sum[ch] / (double)avg->len;
+  var = avg->sq_sum[ch] / (double)avg->len - mean * mean;
+
+  return var > 0.0 ? sqrt(var) : 0.0;
+}
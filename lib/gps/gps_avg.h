@@ -0,0 +1,90 @@
+#ifndef GPS_AVG_H
+#define GPS_AVG_H
+
+#include "gps_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 채널 수 최대 (위도/경도/타원체고/해발고) */
+#define GPS_AVG_CH_MAX 4
+
+/**
+ * @brief 이동 평균 (윈도우 크기 고정, 채널별 평균/표준편차)
+ *
+ * 샘플은 기준값(ref)에 대한 편차로 저장하고, 편차의 합과 제곱합을 누적해
+ * 샘플 1개당 O(1)로 평균과 분산을 갱신한다.
+ * 윈도우가 한 바퀴 돌 때마다 합을 버퍼에서 다시 계산해 부동소수점 오차
+ * 누적을 막고, 이때 기준값을 현재 평균으로 옮겨 편차를 작게 유지한다.
+ */
+typedef struct {
+  double buf[GPS_AVG_WINDOW_MAX][GPS_AVG_CH_MAX]; ///< 기준값에 대한 편차
+  double ref[GPS_AVG_CH_MAX];
+  double sum[GPS_AVG_CH_MAX];
+  double sq_sum[GPS_AVG_CH_MAX];
+  uint16_t window;
+  uint16_t pos;
+  uint16_t len;
+  uint8_t ch;
+} gps_avg_t;
+
+/**
+ * @brief 이동 평균 초기화
+ *
+ * @param avg 이동 평균
+ * @param ch 채널 수 (1 ~ GPS_AVG_CH_MAX)
+ * @param window 윈도우 크기 (1 ~ GPS_AVG_WINDOW_MAX, 범위 밖이면 잘림)
+ */
+void gps_avg_init(gps_avg_t *avg, uint8_t ch, uint16_t window);
+
+/**
+ * @brief 누적된 샘플 버리기 (채널 수, 윈도우 크기는 유지)
+ *
+ * @param avg 이동 평균
+ */
+void gps_avg_reset(gps_avg_t *avg);
+
+/**
+ * @brief 윈도우 크기 변경 (누적된 샘플은 버림)
+ *
+ * @param avg 이동 평균
+ * @param window 윈도우 크기
+ */
+void gps_avg_set_window(gps_avg_t *avg, uint16_t window);
+
+/**
+ * @brief 샘플 추가
+ *
+ * 윈도우가 가득 차 있으면 가장 오래된 샘플을 밀어낸다.
+ *
+ * @param avg 이동 평균
+ * @param val 채널 수만큼의 값
+ */
+void gps_avg_add(gps_avg_t *avg, const double *val);
+
+/**
+ * @brief 채널 평균
+ *
+ * @param avg 이동 평균
+ * @param ch 채널
+ * @return double 평균 (샘플이 없으면 0)
+ */
+double gps_avg_mean(const gps_avg_t *avg, uint8_t ch);
+
+/**
+ * @brief 채널 표준편차 (모표준편차)
+ *
+ * @param avg 이동 평균
+ * @param ch 채널
+ * @return double 표준편차 (샘플이 없으면 0)
+ */
+double gps_avg_stddev(const gps_avg_t *avg, uint8_t ch);
+
+static inline uint16_t gps_avg_count(const gps_avg_t *avg) {
+  return avg->len;
+}
+
+static inline bool gps_avg_is_full(const gps_avg_t *avg) {
+  return avg->window != 0 && avg->len == avg->window;
+}
+
+#endif
@@ -3,24 +3,43 @@
 #include "gps_parse.h"
 #include <string.h>
 
-static double parse_lat_lon(gps_t *gps);
+static int64_t parse_lat_lon(gps_t *gps);
 static void parse_nmea_gga(gps_t *gps);
 
 /**
- * @brief 십진수 도 변환
+ * @brief (d)ddmm.mmmm 문자열을 1e-9 도 단위 정수로 변환
+ *
+ * float로 읽으면 유효숫자 7자리에서 잘려 RTK 해상도에서 수 cm 오차가 나고,
+ * double은 M4F에서 소프트웨어 연산이다. 분 값을 1e-9 분 단위 정수로
+ * 모은 뒤 60으로 나누어 (반올림) 도와 합친다.
  *
  * @param[in] gps
- * @return double
+ * @return int64_t [1e-9 deg]
  */
-static double parse_lat_lon(gps_t *gps) {
-  double val, deg, min;
+static int64_t parse_lat_lon(gps_t *gps) {
+  const char *term = gps->nmea.term_str;
+  uint32_t ddmm = 0;
+  int64_t min_e9;
+  uint32_t frac = 0;
+  uint32_t scale = 1000000000UL;
+
+  for (; PARSER_CHAR_IS_NUM(*term); ++term) {
+    ddmm = ddmm * 10 + PARSER_CHAR_DEC_TO_NUM(*term);
+  }
 
-  val = gps_parse_float(gps);
-  deg = (double)((int)(((int)val / 100)));
-  min = val - (deg * (double)100);
-  val = deg + (min / (double)(60));
+  if (*term == '.') {
+    ++term;
+  }
+
+  // 소수점 아래 9자리(1e-9 분)까지만 사용
+  for (; PARSER_CHAR_IS_NUM(*term) && scale > 1; ++term) {
+    scale /= 10;
+    frac += PARSER_CHAR_DEC_TO_NUM(*term) * scale;
+  }
 
-  return val;
+  min_e9 = (int64_t)(ddmm % 100) * 1000000000LL + frac;
+
+  return (int64_t)(ddmm / 100) * 1000000000LL + (min_e9 + 30) / 60;
 }
 
 /**
@@ -41,6 +60,16 @@ static void parse_nmea_gga(gps_t *gps) {
       gps->nmea_data.gga.sec =
           PARSER_CHAR_DEC_TO_NUM(gps->nmea.term_str[4]) * 10 +
           PARSER_CHAR_DEC_TO_NUM(gps->nmea.term_str[5]);
+
+      // 소수점 아래 (hhmmss.ss)
+      uint16_t msec = 0, scale = 100;
+      if (gps->nmea.term_str[6] == '.') {
+        for (uint8_t i = 7; i < gps->nmea.term_pos && scale > 0; i++) {
+          msec += PARSER_CHAR_DEC_TO_NUM(gps->nmea.term_str[i]) * scale;
+          scale /= 10;
+        }
+      }
+      gps->nmea_data.gga.msec = msec;
     }
     break;
 
@@ -149,3 +178,29 @@ uint8_t gps_parse_nmea_term(gps_t *gps) {
 
   return 1;
 }
+
+/**
+ * @brief 완성된 GGA를 통합 항법해에 병합
+ *
+ * @param[inout] gps
+ */
+void gps_nmea_merge_gga(gps_t *gps) {
+  const gps_gga_t *gga = &gps->nmea_data.gga;
+  uint32_t tod_ms = ((gga->hour * 60UL + gga->min) * 60UL + gga->sec) * 1000UL +
+                    gga->msec;
+
+  gps_sol_begin(gps, GPS_SOL_SRC_NMEA_GGA, tod_ms);
+
+  gps_sol_set_fix(gps, GPS_SOL_SRC_NMEA_GGA, gga->fix);
+  gps_sol_set_sats(gps, GPS_SOL_SRC_NMEA_GGA, gga->sat_num);
+  gps_sol_set_dop(gps, GPS_SOL_SRC_NMEA_GGA, (float)gga->hdop);
+
+  if (gga->fix != GPS_FIX_INVALID) {
+    gps_sol_set_pos(gps, GPS_SOL_SRC_NMEA_GGA,
+                    GPS_NMEA_NDEG_TO_DEG(gga->ns == 'S' ? -gga->lat : gga->lat),
+                    GPS_NMEA_NDEG_TO_DEG(gga->ew == 'W' ? -gga->lon : gga->lon),
+                    gga->alt + gga->geo_sep, gga->alt);
+  }
+
+  gps_sol_end(gps, GPS_SOL_SRC_NMEA_GGA);
+}
@@ -5,7 +5,11 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-#define GPS_NMEA_TERM_SIZE 13
+/* dddmm.mmmmmmmm 경도 term이 잘리지 않는 크기 (NUL 포함) */
+#define GPS_NMEA_TERM_SIZE 16
+
+/* GGA 위/경도 단위 [1e-9 deg] -> [deg] */
+#define GPS_NMEA_NDEG_TO_DEG(x) ((double)(x) * 1e-9)
 
 /**
  * @brief GGA quality fix 상태
@@ -33,9 +37,10 @@ typedef struct {
   uint8_t hour;
   uint8_t min;
   uint8_t sec;
-  double lat;
+  uint16_t msec;
+  int64_t lat;   // [1e-9 deg] (부호 없음, ns로 구분)
   char ns;
-  double lon;
+  int64_t lon;   // [1e-9 deg] (부호 없음, ew로 구분)
   char ew;
   gps_fix_t fix;
   uint8_t sat_num;
@@ -74,5 +79,6 @@ typedef struct {
 typedef struct gps_s gps_t;
 
 uint8_t gps_parse_nmea_term(gps_t *gps);
+void gps_nmea_merge_gga(gps_t *gps);
 
 #endif
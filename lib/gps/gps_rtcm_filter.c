@@ -0,0 +1,162 @@
+#include "gps_rtcm_filter.h"
+#include <string.h>
+
+_Static_assert(GPS_RTCM_FILTER_MAX_RULES <= 32, "sent_mask is 32 bits");
+
+/**
+ * @brief 메시지 타입의 규칙 인덱스
+ *
+ * @return 규칙 인덱스, 없으면 -1
+ */
+static int gps_rtcm_filter_find(const gps_rtcm_filter_t *f, uint16_t msg_type) {
+  for (uint8_t i = 0; i < f->rule_cnt; i++) {
+    if (f->rule[i].msg_type == msg_type) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief 필터 초기화
+ */
+void gps_rtcm_filter_init(gps_rtcm_filter_t *f, const gps_rtcm_rule_t *rules,
+                          uint8_t cnt, uint8_t gnss_mask, bool whitelist) {
+  memset(f, 0, sizeof(*f));
+
+  if (cnt > GPS_RTCM_FILTER_MAX_RULES) {
+    cnt = GPS_RTCM_FILTER_MAX_RULES;
+  }
+  if (rules && cnt) {
+    memcpy(f->rule, rules, cnt * sizeof(rules[0]));
+    f->rule_cnt = cnt;
+  }
+
+  f->gnss_mask = gnss_mask;
+  f->whitelist = whitelist;
+}
+
+/**
+ * @brief 메시지 타입 전송 간격 변경
+ */
+bool gps_rtcm_filter_set_interval(gps_rtcm_filter_t *f, uint16_t msg_type,
+                                  uint32_t interval_ms) {
+  int i = gps_rtcm_filter_find(f, msg_type);
+
+  if (i < 0) {
+    if (f->rule_cnt >= GPS_RTCM_FILTER_MAX_RULES) {
+      return false;
+    }
+    i = f->rule_cnt++;
+    f->rule[i].msg_type = msg_type;
+  }
+
+  f->rule[i].interval_ms = interval_ms;
+  f->sent_mask &= ~(1UL << i);
+
+  return true;
+}
+
+/**
+ * @brief 메시지 타입 규칙 제거
+ */
+void gps_rtcm_filter_remove(gps_rtcm_filter_t *f, uint16_t msg_type) {
+  int i = gps_rtcm_filter_find(f, msg_type);
+
+  if (i < 0) {
+    return;
+  }
+
+  // 마지막 규칙을 빈 자리로 옮김
+  f->rule_cnt--;
+  f->rule[i] = f->rule[f->rule_cnt];
+  f->last_tick[i] = f->last_tick[f->rule_cnt];
+  f->last_epoch[i] = f->last_epoch[f->rule_cnt];
+  if (f->sent_mask & (1UL << f->rule_cnt)) {
+    f->sent_mask |= (1UL << i);
+  } else {
+    f->sent_mask &= ~(1UL << i);
+  }
+  f->sent_mask &= ~(1UL << f->rule_cnt);
+}
+
+/**
+ * @brief 통과시킬 위성 시스템 변경
+ */
+void gps_rtcm_filter_set_gnss_mask(gps_rtcm_filter_t *f, uint8_t gnss_mask) {
+  f->gnss_mask = gnss_mask;
+}
+
+/**
+ * @brief 타입/위성 시스템/간격 규칙 적용 (버리면 사유별 통계 증가)
+ */
+static bool gps_rtcm_filter_judge(gps_rtcm_filter_t *f, const uint8_t *data,
+                                  uint32_t now_ms) {
+  uint16_t msg_type = rtcm_get_message_type(data);
+  rtcm_gnss_t gnss = rtcm_msg_gnss(msg_type);
+  uint32_t epoch = 0;
+  bool msm;
+  int i;
+
+  if (gnss != RTCM_GNSS_NONE && !(f->gnss_mask & GPS_RTCM_GNSS_BIT(gnss))) {
+    f->stats.drop_gnss++;
+    return false;
+  }
+
+  i = gps_rtcm_filter_find(f, msg_type);
+  if (i < 0) {
+    if (f->whitelist) {
+      f->stats.drop_type++;
+      return false;
+    }
+    return true;
+  }
+
+  if (f->rule[i].interval_ms == 0) {
+    return true;
+  }
+
+  msm = rtcm_is_msm(msg_type) &&
+        rtcm_get_payload_length(data) * 8u >= RTCM_MSM_CELL_MASK_POS;
+  if (msm) {
+    epoch = rtcm_msm_epoch(data);
+  }
+
+  if (f->sent_mask & (1UL << i)) {
+    // 이미 통과시킨 epoch의 나머지 조각
+    if (msm && epoch == f->last_epoch[i]) {
+      return true;
+    }
+
+    // 출력 주기 흔들림으로 한 주기씩 밀리지 않도록 여유를 둠
+    if (now_ms - f->last_tick[i] + GPS_RTCM_FILTER_JITTER_MS < f->rule[i].interval_ms) {
+      f->stats.drop_rate++;
+      return false;
+    }
+  }
+
+  f->sent_mask |= (1UL << i);
+  f->last_tick[i] = now_ms;
+  f->last_epoch[i] = epoch;
+
+  return true;
+}
+
+/**
+ * @brief 프레임 통과 여부 판정
+ */
+bool gps_rtcm_filter_check(gps_rtcm_filter_t *f, const uint8_t *data,
+                           uint16_t len, uint32_t now_ms) {
+  if (!f || !data || len < RTCM3_MIN_PACKET_SIZE) {
+    return false;
+  }
+
+  if (!gps_rtcm_filter_judge(f, data, now_ms)) {
+    f->stats.dropped_bytes += len;
+    return false;
+  }
+
+  f->stats.passed++;
+  f->stats.passed_bytes += len;
+  return true;
+}
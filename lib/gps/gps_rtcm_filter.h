@@ -0,0 +1,102 @@
+#ifndef GPS_RTCM_FILTER_H
+#define GPS_RTCM_FILTER_H
+
+#include "gps_config.h"
+#include "rtcm.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* 위성 시스템 마스크 비트 */
+#define GPS_RTCM_GNSS_BIT(g) (1u << (g))
+
+/**
+ * @brief 메시지 타입별 규칙
+ */
+typedef struct {
+  uint16_t msg_type;     // RTCM 메시지 타입
+  uint32_t interval_ms;  // 최소 전송 간격 (0: 매번 전송)
+} gps_rtcm_rule_t;
+
+/**
+ * @brief 필터 통계
+ */
+typedef struct {
+  uint32_t passed;         // 통과한 프레임 수
+  uint32_t passed_bytes;
+  uint32_t drop_type;      // 규칙에 없는 타입 (화이트리스트)
+  uint32_t drop_gnss;      // 마스크에서 뺀 위성 시스템
+  uint32_t drop_rate;      // 간격 미달 (데시메이션)
+  uint32_t dropped_bytes;
+} gps_rtcm_filter_stats_t;
+
+/**
+ * @brief RTCM 출력 필터
+ *
+ * 프레임마다 메시지 타입과 (MSM이면) epoch 시간만 프레임 버퍼에서 읽어
+ * 통과 여부를 정한다. 간격이 있는 MSM은 한 epoch가 여러 메시지로 나뉘어
+ * 와도 (multiple message) 첫 조각이 통과한 epoch의 나머지 조각은 같이
+ * 통과시켜 epoch가 반쪽만 나가지 않게 한다.
+ */
+typedef struct {
+  gps_rtcm_rule_t rule[GPS_RTCM_FILTER_MAX_RULES];
+  uint32_t last_tick[GPS_RTCM_FILTER_MAX_RULES];   // 마지막 통과 시각 [ms]
+  uint32_t last_epoch[GPS_RTCM_FILTER_MAX_RULES];  // 마지막 통과 MSM epoch
+  uint32_t sent_mask;                              // 한 번이라도 통과한 규칙
+  uint8_t rule_cnt;
+  uint8_t gnss_mask;   // 통과시킬 위성 시스템 (GPS_RTCM_GNSS_BIT)
+  bool whitelist;      // true: 규칙에 없는 타입은 버림
+  gps_rtcm_filter_stats_t stats;
+} gps_rtcm_filter_t;
+
+/**
+ * @brief 필터 초기화
+ *
+ * @param f 필터
+ * @param rules 규칙 테이블 (GPS_RTCM_FILTER_MAX_RULES 초과분은 무시)
+ * @param cnt 규칙 수
+ * @param gnss_mask 통과시킬 위성 시스템
+ * @param whitelist true: 규칙에 없는 타입은 버림, false: 그대로 통과
+ */
+void gps_rtcm_filter_init(gps_rtcm_filter_t *f, const gps_rtcm_rule_t *rules,
+                          uint8_t cnt, uint8_t gnss_mask, bool whitelist);
+
+/**
+ * @brief 메시지 타입 전송 간격 변경 (없으면 규칙 추가)
+ *
+ * @param f 필터
+ * @param msg_type RTCM 메시지 타입
+ * @param interval_ms 최소 전송 간격 (0: 매번 전송)
+ * @return true: 성공, false: 규칙 테이블이 가득 참
+ */
+bool gps_rtcm_filter_set_interval(gps_rtcm_filter_t *f, uint16_t msg_type,
+                                  uint32_t interval_ms);
+
+/**
+ * @brief 메시지 타입 규칙 제거 (화이트리스트면 이후 버려짐)
+ *
+ * @param f 필터
+ * @param msg_type RTCM 메시지 타입
+ */
+void gps_rtcm_filter_remove(gps_rtcm_filter_t *f, uint16_t msg_type);
+
+/**
+ * @brief 통과시킬 위성 시스템 변경
+ *
+ * @param f 필터
+ * @param gnss_mask GPS_RTCM_GNSS_BIT 조합
+ */
+void gps_rtcm_filter_set_gnss_mask(gps_rtcm_filter_t *f, uint8_t gnss_mask);
+
+/**
+ * @brief 프레임 통과 여부 판정 (통과하면 간격 기준 시각 갱신)
+ *
+ * @param f 필터
+ * @param data RTCM 패킷 (프리앰블부터)
+ * @param len 패킷 길이
+ * @param now_ms 현재 시각 [ms]
+ * @return true: 전송, false: 버림
+ */
+bool gps_rtcm_filter_check(gps_rtcm_filter_t *f, const uint8_t *data,
+                           uint16_t len, uint32_t now_ms);
+
+#endif
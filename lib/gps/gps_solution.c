@@ -0,0 +1,165 @@
+#include "gps_solution.h"
+#include "gps.h"
+#include <string.h>
+
+#define GPS_SOL_DAY_MS 86400000UL
+#define GPS_SOL_WEEK_MS (7UL * GPS_SOL_DAY_MS)
+
+/**
+ * @brief 이번 에포크에 필드를 쓸 수 있는지 확인하고 출처/시각 기록
+ *
+ * @param[inout] ctx
+ * @param[in] field 필드 그룹
+ * @param[in] src 출처
+ * @return true: 써도 됨 (같은 에포크에 더 우선인 출처가 없음)
+ */
+static bool gps_sol_take(gps_sol_ctx_t *ctx, gps_sol_field_t field,
+                         gps_sol_src_t src) {
+  if (ctx->set_src[field] > src) {
+    return false;
+  }
+
+  ctx->set_src[field] = src;
+  ctx->cur.src[field] = src;
+  ctx->cur.tick[field] = xTaskGetTickCount();
+
+  return true;
+}
+
+/**
+ * @brief 현재 에포크 항법해 내보내기
+ *
+ * @param[inout] gps
+ */
+static void gps_sol_emit(gps_t *gps) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  ctx->cur.epoch++;
+  ctx->out = ctx->cur;
+  ctx->emitted = true;
+
+  _gps_nav_publish(gps, GPS_PROTOCOL_NONE);
+
+  if (gps->handler) {
+    gps_msg_t msg = {0};
+    gps->handler(gps, GPS_EVENT_SOLUTION, GPS_PROTOCOL_NONE, msg);
+  }
+}
+
+/**
+ * @brief 메시지 병합 시작 (에포크 경계 판단)
+ *
+ * @param[inout] gps
+ * @param[in] src 출처
+ * @param[in] tod_ms 메시지의 UTC 하루 중 시각 [ms]
+ */
+void gps_sol_begin(gps_t *gps, gps_sol_src_t src, uint32_t tod_ms) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (ctx->started && tod_ms != ctx->cur.tod_ms) {
+    // 다 모이기 전에 다음 에포크가 시작됨: 모인 만큼 내보냄
+    if (!ctx->emitted) {
+      gps_sol_emit(gps);
+    }
+
+    ctx->expect_mask = ctx->cur.src_mask;
+    ctx->cur.src_mask = 0;
+    memset(ctx->set_src, 0, sizeof(ctx->set_src));
+    ctx->emitted = false;
+  }
+
+  ctx->started = true;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_TIME, src)) {
+    ctx->cur.tod_ms = tod_ms;
+  }
+}
+
+/**
+ * @brief 메시지 병합 끝 (에포크 완성 시 내보냄)
+ *
+ * @param[inout] gps
+ * @param[in] src 출처
+ */
+void gps_sol_end(gps_t *gps, gps_sol_src_t src) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  ctx->cur.src_mask |= (uint16_t)(1u << src);
+
+  if (!ctx->emitted &&
+      (ctx->cur.src_mask & ctx->expect_mask) == ctx->expect_mask) {
+    gps_sol_emit(gps);
+  }
+}
+
+void gps_sol_set_pos(gps_t *gps, gps_sol_src_t src, double lat, double lon,
+                     double height, double msl) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_POS, src)) {
+    ctx->cur.lat = lat;
+    ctx->cur.lon = lon;
+    ctx->cur.height = height;
+    ctx->cur.msl = msl;
+  }
+}
+
+void gps_sol_set_acc(gps_t *gps, gps_sol_src_t src, float hacc, float vacc) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_ACC, src)) {
+    ctx->cur.hacc = hacc;
+    ctx->cur.vacc = vacc;
+  }
+}
+
+void gps_sol_set_fix(gps_t *gps, gps_sol_src_t src, gps_fix_t fix) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_FIX, src)) {
+    ctx->cur.fix = fix;
+  }
+}
+
+void gps_sol_set_sats(gps_t *gps, gps_sol_src_t src, uint8_t sats) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_SATS, src)) {
+    ctx->cur.sats = sats;
+  }
+}
+
+void gps_sol_set_dop(gps_t *gps, gps_sol_src_t src, float hdop) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_DOP, src)) {
+    ctx->cur.hdop = hdop;
+  }
+}
+
+void gps_sol_set_heading(gps_t *gps, gps_sol_src_t src, float heading,
+                         float heading_acc) {
+  gps_sol_ctx_t *ctx = &gps->sol;
+
+  if (gps_sol_take(ctx, GPS_SOL_FIELD_HEADING, src)) {
+    ctx->cur.heading = heading;
+    ctx->cur.heading_acc = heading_acc;
+  }
+}
+
+/**
+ * @brief GPS 주간 시각 -> UTC 하루 중 시각
+ *
+ * @param[in] tow_ms GPS time of week [ms]
+ * @return uint32_t UTC 하루 중 시각 [ms]
+ */
+uint32_t gps_sol_gps_tow_to_tod(uint32_t tow_ms) {
+  uint32_t leap_ms = GPS_UTC_LEAP_SECONDS * 1000UL;
+
+  tow_ms %= GPS_SOL_WEEK_MS;
+  if (tow_ms < leap_ms) {
+    tow_ms += GPS_SOL_WEEK_MS;
+  }
+
+  return (tow_ms - leap_ms) % GPS_SOL_DAY_MS;
+}
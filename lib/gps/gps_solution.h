@@ -0,0 +1,101 @@
+#ifndef GPS_SOLUTION_H
+#define GPS_SOLUTION_H
+
+#include "gps_nmea.h"
+#include "FreeRTOS.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct gps_s gps_t;
+
+/**
+ * @brief 항법해 필드 출처
+ *
+ * 같은 에포크 안에서는 값이 큰 출처가 작은 출처를 덮어쓴다.
+ */
+typedef enum {
+  GPS_SOL_SRC_NONE = 0,
+  GPS_SOL_SRC_NMEA_GGA,
+  GPS_SOL_SRC_UBX_NAV_PVT,
+  GPS_SOL_SRC_UBX_RELPOSNED,
+  GPS_SOL_SRC_UBX_HPPOSLLH,
+  GPS_SOL_SRC_UNICORE_PVTSLN,
+  GPS_SOL_SRC_UNICORE_BESTNAV,
+  GPS_SOL_SRC_UNICORE_ADRNAV,
+  GPS_SOL_SRC_UNICORE_HEADING,
+  GPS_SOL_SRC_MAX
+} gps_sol_src_t;
+
+/**
+ * @brief 항법해 필드 그룹 (출처/시각 관리 단위)
+ */
+typedef enum {
+  GPS_SOL_FIELD_TIME = 0,  // tod_ms
+  GPS_SOL_FIELD_POS,       // lat, lon, height, msl
+  GPS_SOL_FIELD_ACC,       // hacc, vacc
+  GPS_SOL_FIELD_FIX,       // fix
+  GPS_SOL_FIELD_SATS,      // sats
+  GPS_SOL_FIELD_DOP,       // hdop
+  GPS_SOL_FIELD_HEADING,   // heading, heading_acc
+  GPS_SOL_FIELD_MAX
+} gps_sol_field_t;
+
+/**
+ * @brief 통합 항법해 (에포크 단위)
+ *
+ * NMEA/UBX/Unicore 중 해당 필드를 준 프로토콜의 값으로 채운다.
+ * 이번 에포크에 갱신되지 않은 필드는 이전 값을 유지하며, tick으로 구분한다.
+ */
+typedef struct {
+  uint32_t epoch;      // 에포크 번호
+  uint32_t tod_ms;     // UTC 하루 중 시각 [ms]
+
+  double lat;          // [deg] (남위 음수)
+  double lon;          // [deg] (서경 음수)
+  double height;       // 타원체고 [m]
+  double msl;          // 해발고 [m]
+  float hacc;          // 수평 정확도 [m]
+  float vacc;          // 수직 정확도 [m]
+  gps_fix_t fix;
+  uint8_t sats;
+  float hdop;
+  float heading;       // 기선 방향 (moving base) [deg]
+  float heading_acc;   // [deg]
+
+  uint16_t src_mask;   // 이번 에포크에 합쳐진 출처 (1 << gps_sol_src_t)
+  uint8_t src[GPS_SOL_FIELD_MAX];      // 필드별 출처 (gps_sol_src_t)
+  TickType_t tick[GPS_SOL_FIELD_MAX];  // 필드별 갱신 시각
+} gps_solution_t;
+
+/**
+ * @brief 항법해 병합 상태
+ *
+ * 에포크는 메시지 시각(UTC 하루 중 ms)으로 구분한다. 직전 에포크에 들어온
+ * 출처 조합이 이번 에포크에도 모두 들어오면 바로 내보내고, 다 오기 전에
+ * 다음 에포크가 시작되면 그때 내보낸다. 따라서 수신기 출력 메시지를 줄여도
+ * 다음 에포크부터 자동으로 맞춰진다.
+ */
+typedef struct {
+  gps_solution_t cur;     // 병합 중
+  gps_solution_t out;     // 마지막으로 내보낸 항법해
+  uint16_t expect_mask;   // 직전 에포크의 출처 조합
+  uint8_t set_src[GPS_SOL_FIELD_MAX];  // 이번 에포크에 필드를 채운 출처
+  bool started;
+  bool emitted;
+} gps_sol_ctx_t;
+
+void gps_sol_begin(gps_t *gps, gps_sol_src_t src, uint32_t tod_ms);
+void gps_sol_end(gps_t *gps, gps_sol_src_t src);
+
+void gps_sol_set_pos(gps_t *gps, gps_sol_src_t src, double lat, double lon,
+                     double height, double msl);
+void gps_sol_set_acc(gps_t *gps, gps_sol_src_t src, float hacc, float vacc);
+void gps_sol_set_fix(gps_t *gps, gps_sol_src_t src, gps_fix_t fix);
+void gps_sol_set_sats(gps_t *gps, gps_sol_src_t src, uint8_t sats);
+void gps_sol_set_dop(gps_t *gps, gps_sol_src_t src, float hdop);
+void gps_sol_set_heading(gps_t *gps, gps_sol_src_t src, float heading,
+                         float heading_acc);
+
+uint32_t gps_sol_gps_tow_to_tod(uint32_t tow_ms);
+
+#endif
@@ -0,0 +1,246 @@
+#include "gps_survey.h"
+#include <math.h>
+#include <string.h>
+
+#define WGS84_A 6378137.0
+#define WGS84_F (1.0 / 298.257223563)
+#define WGS84_E2 (WGS84_F * (2.0 - WGS84_F))
+
+#define DEG_TO_RAD (3.14159265358979323846 / 180.0)
+
+/* 기준점 편차 한계 [0.1mm] */
+#define GPS_SURVEY_MAX_DEV ((int64_t)(GPS_SURVEY_MAX_DEV_M * GPS_SURVEY_ECEF_SCALE))
+
+/* 편차 곱의 합이 int64를 넘지 않는 조건 */
+_Static_assert((double)GPS_SURVEY_MAX_DEV * GPS_SURVEY_MAX_DEV *
+                       GPS_SURVEY_MAX_SAMPLES <
+                   9.2e18,
+               "GPS_SURVEY_MAX_DEV_M * GPS_SURVEY_MAX_SAMPLES overflows int64");
+
+/**
+ * @brief 누적값 초기화
+ *
+ * @param sv 측량
+ */
+static void gps_survey_clear(gps_survey_t *sv) {
+  memset(sv->ref, 0, sizeof(sv->ref));
+  memset(sv->sum, 0, sizeof(sv->sum));
+  memset(sv->prod, 0, sizeof(sv->prod));
+  sv->count = 0;
+  sv->reject_run = 0;
+}
+
+/**
+ * @brief 샘플 공분산 계산 [(0.1mm)^2]
+ *
+ * @param sv 측량 (count > 0)
+ * @param cov 출력 (xx, yy, zz, xy, xz, yz)
+ */
+static void gps_survey_cov(const gps_survey_t *sv, double cov[6]) {
+  static const uint8_t idx[6][2] = {{0, 0}, {1, 1}, {2, 2},
+                                    {0, 1}, {0, 2}, {1, 2}};
+  double n = (double)sv->count;
+
+  for (int k = 0; k < 6; k++) {
+    double mi = (double)sv->sum[idx[k][0]] / n;
+    double mj = (double)sv->sum[idx[k][1]] / n;
+
+    cov[k] = (double)sv->prod[k] / n - mi * mj;
+  }
+
+  for (int k = 0; k < 3; k++) {
+    if (cov[k] < 0.0) {
+      cov[k] = 0.0;
+    }
+  }
+}
+
+/**
+ * @brief 측량 시작
+ */
+void gps_survey_start(gps_survey_t *sv, uint32_t min_samples,
+                      uint32_t target_acc_mm) {
+  gps_survey_clear(sv);
+  sv->reject_total = 0;
+  sv->min_samples = min_samples ? min_samples : 1;
+  sv->target_acc = target_acc_mm / 1000.0;
+  sv->state = GPS_SURVEY_RUNNING;
+}
+
+/**
+ * @brief 측량 중지
+ */
+void gps_survey_stop(gps_survey_t *sv) {
+  if (sv->state == GPS_SURVEY_RUNNING) {
+    sv->state = GPS_SURVEY_IDLE;
+  }
+}
+
+/**
+ * @brief ECEF 샘플 추가
+ */
+bool gps_survey_add_ecef(gps_survey_t *sv, const int64_t ecef[3]) {
+  int64_t d[3];
+  double cov[6];
+  double acc2;
+
+  if (sv->state != GPS_SURVEY_RUNNING || sv->count >= GPS_SURVEY_MAX_SAMPLES) {
+    return false;
+  }
+
+  if (sv->count == 0) {
+    memcpy(sv->ref, ecef, sizeof(sv->ref));
+  }
+
+  for (int i = 0; i < 3; i++) {
+    d[i] = ecef[i] - sv->ref[i];
+
+    if (d[i] > GPS_SURVEY_MAX_DEV || d[i] < -GPS_SURVEY_MAX_DEV) {
+      sv->reject_total++;
+
+      // 기준점 자체가 튄 값이었으면 처음부터 다시
+      if (++sv->reject_run >= GPS_SURVEY_MAX_REJECT_RUN) {
+        gps_survey_clear(sv);
+      }
+      return false;
+    }
+  }
+
+  sv->reject_run = 0;
+
+  sv->sum[0] += d[0];
+  sv->sum[1] += d[1];
+  sv->sum[2] += d[2];
+  sv->prod[0] += d[0] * d[0];
+  sv->prod[1] += d[1] * d[1];
+  sv->prod[2] += d[2] * d[2];
+  sv->prod[3] += d[0] * d[1];
+  sv->prod[4] += d[0] * d[2];
+  sv->prod[5] += d[1] * d[2];
+  sv->count++;
+
+  if (sv->count < sv->min_samples) {
+    return false;
+  }
+
+  // 평균 정확도^2 = trace(cov) / n (제곱근 없이 비교)
+  gps_survey_cov(sv, cov);
+  acc2 = (cov[0] + cov[1] + cov[2]) / (double)sv->count /
+         (GPS_SURVEY_ECEF_SCALE * GPS_SURVEY_ECEF_SCALE);
+
+  if (acc2 <= sv->target_acc * sv->target_acc) {
+    sv->state = GPS_SURVEY_DONE;
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * @brief 측지 좌표 샘플 추가
+ */
+bool gps_survey_add_llh(gps_survey_t *sv, double lat, double lon,
+                        double height) {
+  double xyz[3];
+  int64_t ecef[3];
+
+  if (sv->state != GPS_SURVEY_RUNNING) {
+    return false;
+  }
+
+  gps_llh_to_ecef(lat, lon, height, xyz);
+
+  for (int i = 0; i < 3; i++) {
+    ecef[i] = (int64_t)llround(xyz[i] * GPS_SURVEY_ECEF_SCALE);
+  }
+
+  return gps_survey_add_ecef(sv, ecef);
+}
+
+/**
+ * @brief 평균 ECEF 좌표 (고정소수점)
+ */
+bool gps_survey_get_ecef(const gps_survey_t *sv, int64_t ecef[3]) {
+  if (sv->count == 0) {
+    return false;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    ecef[i] = sv->ref[i] + (int64_t)llround((double)sv->sum[i] / sv->count);
+  }
+
+  return true;
+}
+
+/**
+ * @brief 현재 측량 결과
+ */
+bool gps_survey_get_result(const gps_survey_t *sv, gps_survey_result_t *res) {
+  const double s2 = GPS_SURVEY_ECEF_SCALE * GPS_SURVEY_ECEF_SCALE;
+  double var;
+
+  memset(res, 0, sizeof(*res));
+  res->state = sv->state;
+  res->rejected = sv->reject_total;
+
+  if (sv->count == 0) {
+    return false;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    res->ecef[i] = ((double)sv->ref[i] + (double)sv->sum[i] / sv->count) /
+                   GPS_SURVEY_ECEF_SCALE;
+  }
+
+  gps_survey_cov(sv, res->cov);
+  for (int k = 0; k < 6; k++) {
+    res->cov[k] /= s2;
+  }
+
+  var = res->cov[0] + res->cov[1] + res->cov[2];
+  res->std_3d = sqrt(var);
+  res->mean_acc = sqrt(var / sv->count);
+  res->count = sv->count;
+
+  gps_ecef_to_llh(res->ecef, &res->lat, &res->lon, &res->height);
+
+  return true;
+}
+
+/**
+ * @brief WGS84 측지 좌표 -> ECEF
+ */
+void gps_llh_to_ecef(double lat, double lon, double height, double ecef[3]) {
+  double sin_lat = sin(lat * DEG_TO_RAD);
+  double cos_lat = cos(lat * DEG_TO_RAD);
+  double n = WGS84_A / sqrt(1.0 - WGS84_E2 * sin_lat * sin_lat);
+
+  ecef[0] = (n + height) * cos_lat * cos(lon * DEG_TO_RAD);
+  ecef[1] = (n + height) * cos_lat * sin(lon * DEG_TO_RAD);
+  ecef[2] = (n * (1.0 - WGS84_E2) + height) * sin_lat;
+}
+
+/**
+ * @brief ECEF -> WGS84 측지 좌표
+ *
+ * 위도를 반복 계산한다 (지표 근처에서 5회면 0.1mm 이하로 수렴).
+ */
+void gps_ecef_to_llh(const double ecef[3], double *lat, double *lon,
+                     double *height) {
+  double p = sqrt(ecef[0] * ecef[0] + ecef[1] * ecef[1]);
+  double phi = atan2(ecef[2], p * (1.0 - WGS84_E2));
+  double n = WGS84_A;
+  double h = 0.0;
+
+  for (int i = 0; i < 5; i++) {
+    double sin_phi = sin(phi);
+
+    n = WGS84_A / sqrt(1.0 - WGS84_E2 * sin_phi * sin_phi);
+    h = p / cos(phi) - n;
+    phi = atan2(ecef[2], p * (1.0 - WGS84_E2 * n / (n + h)));
+  }
+
+  *lat = phi / DEG_TO_RAD;
+  *lon = atan2(ecef[1], ecef[0]) / DEG_TO_RAD;
+  *height = h;
+}
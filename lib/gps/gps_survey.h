@@ -0,0 +1,137 @@
+#ifndef GPS_SURVEY_H
+#define GPS_SURVEY_H
+
+#include "gps_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ECEF 고정소수점 단위: 0.1 mm (F9P TMODE HP 분해능과 동일) */
+#define GPS_SURVEY_ECEF_SCALE 10000.0
+
+/**
+ * @brief 베이스 좌표 측량 상태
+ */
+typedef enum {
+  GPS_SURVEY_IDLE = 0,  // 시작 전
+  GPS_SURVEY_RUNNING,   // 샘플 누적 중
+  GPS_SURVEY_DONE,      // 목표 정확도 도달 (누적 중단)
+} gps_survey_state_t;
+
+/**
+ * @brief 베이스 좌표 측량 (survey-in)
+ *
+ * 위치 샘플을 ECEF 0.1 mm 정수로 바꿔 첫 샘플(기준점)에 대한 편차의
+ * 합과 곱의 합(xx, yy, zz, xy, xz, yz)을 int64로 누적한다. 샘플을 저장하지
+ * 않으므로 RAM과 샘플당 연산량이 일정하고, 정수 누적이라 오차가 쌓이지 않는다.
+ * 기준점에서 GPS_SURVEY_MAX_DEV_M 이상 떨어진 샘플은 버리며, 이 거리와
+ * GPS_SURVEY_MAX_SAMPLES로 제곱합이 int64를 넘지 않음이 보장된다.
+ */
+typedef struct {
+  gps_survey_state_t state;
+
+  int64_t ref[3];   ///< 기준점 ECEF [0.1mm]
+  int64_t sum[3];   ///< 편차 합
+  int64_t prod[6];  ///< 편차 곱의 합 (xx, yy, zz, xy, xz, yz)
+  uint32_t count;
+
+  uint32_t reject_run;    ///< 연속으로 버린 샘플 수
+  uint32_t reject_total;
+
+  uint32_t min_samples;   ///< 완료 판정 최소 샘플 수
+  double target_acc;      ///< 완료 판정 평균 정확도 [m]
+} gps_survey_t;
+
+/**
+ * @brief 측량 결과
+ */
+typedef struct {
+  gps_survey_state_t state;
+  double ecef[3];     // 평균 ECEF [m]
+  double lat;         // [deg]
+  double lon;         // [deg]
+  double height;      // 타원체고 [m]
+  double cov[6];      // 샘플 공분산 [m^2] (xx, yy, zz, xy, xz, yz)
+  double std_3d;      // 샘플 3D 표준편차 [m]
+  double mean_acc;    // 평균 위치 정확도 [m] (std_3d / sqrt(count))
+  uint32_t count;
+  uint32_t rejected;
+} gps_survey_result_t;
+
+/**
+ * @brief 측량 시작 (누적된 샘플은 버림)
+ *
+ * @param sv 측량
+ * @param min_samples 완료 판정 최소 샘플 수
+ * @param target_acc_mm 완료 판정 평균 정확도 [mm]
+ */
+void gps_survey_start(gps_survey_t *sv, uint32_t min_samples,
+                      uint32_t target_acc_mm);
+
+/**
+ * @brief 측량 중지 (결과는 유지)
+ *
+ * @param sv 측량
+ */
+void gps_survey_stop(gps_survey_t *sv);
+
+/**
+ * @brief ECEF 샘플 추가
+ *
+ * @param sv 측량
+ * @param ecef ECEF [0.1mm]
+ * @return true: 이번 샘플로 목표 정확도에 도달함 (한 번만 true)
+ */
+bool gps_survey_add_ecef(gps_survey_t *sv, const int64_t ecef[3]);
+
+/**
+ * @brief 측지 좌표 샘플 추가 (WGS84)
+ *
+ * @param sv 측량
+ * @param lat 위도 [deg]
+ * @param lon 경도 [deg]
+ * @param height 타원체고 [m]
+ * @return true: 이번 샘플로 목표 정확도에 도달함 (한 번만 true)
+ */
+bool gps_survey_add_llh(gps_survey_t *sv, double lat, double lon,
+                        double height);
+
+/**
+ * @brief 현재 측량 결과
+ *
+ * @param sv 측량
+ * @param res 결과 출력
+ * @return true: 샘플 있음
+ */
+bool gps_survey_get_result(const gps_survey_t *sv, gps_survey_result_t *res);
+
+/**
+ * @brief 평균 ECEF 좌표 (고정소수점)
+ *
+ * @param sv 측량
+ * @param ecef ECEF [0.1mm] 출력
+ * @return true: 샘플 있음
+ */
+bool gps_survey_get_ecef(const gps_survey_t *sv, int64_t ecef[3]);
+
+/**
+ * @brief WGS84 측지 좌표 -> ECEF
+ *
+ * @param lat 위도 [deg]
+ * @param lon 경도 [deg]
+ * @param height 타원체고 [m]
+ * @param ecef ECEF [m] 출력
+ */
+void gps_llh_to_ecef(double lat, double lon, double height, double ecef[3]);
+
+/**
+ * @brief ECEF -> WGS84 측지 좌표
+ *
+ * @param ecef ECEF [m]
+ * @param lat 위도 [deg] 출력
+ * @param lon 경도 [deg] 출력
+ * @param height 타원체고 [m] 출력
+ */
+void gps_ecef_to_llh(const double ecef[3], double *lat, double *lon,
+                     double *height);
+
+#endif
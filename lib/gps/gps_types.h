@@ -28,6 +28,7 @@ typedef enum {
   /* 공통 데이터 이벤트 */
   GPS_EVENT_DATA_PARSED,  // 프로토콜 데이터 파싱 완료
   GPS_EVENT_RTCM_PACKET,  // RTCM 패킷 파싱 완료
+  GPS_EVENT_SOLUTION,     // 에포크 통합 항법해 완성 (gps->sol.out)
 
   GPS_EVENT_INVALID = UINT8_MAX
 } gps_event_t;
@@ -64,7 +65,7 @@ typedef enum {
   /* UNICORE Binary protocol */
   GPS_PARSE_STATE_UNICORE_BIN_SYNC_1 = 22,  // 0xAA
   GPS_PARSE_STATE_UNICORE_BIN_SYNC_2 = 23,  // 0x44
-  GPS_PARSE_STATE_UNICORE_BIN_SYNC_3 = 24,  // 0x12
+  GPS_PARSE_STATE_UNICORE_BIN_SYNC_3 = 24,  // 0xB5
   GPS_PARSE_STATE_UNICORE_BIN_HEADER = 25,
   GPS_PARSE_STATE_UNICORE_BIN_PAYLOAD = 26,
   GPS_PARSE_STATE_UNICORE_BIN_CRC = 27,
@@ -95,6 +96,7 @@ typedef union
         uint8_t class;
         uint8_t id;
     }ubx;
+    uint16_t unicore;  // Unicore 바이너리 메시지 ID
 }gps_msg_t;
 
 #endif
@@ -6,6 +6,7 @@
 static inline void calc_ubx_chksum(gps_t *gps);
 static inline uint8_t check_ubx_chksum(gps_t *gps);
 static void store_ubx_nav_data(gps_t *gps);
+static void store_ubx_rxm_data(gps_t *gps);
 static void store_ubx_data(gps_t *gps);
 
 /**
@@ -40,16 +41,345 @@ static inline uint8_t check_ubx_chksum(gps_t *gps) {
   return 0;
 }
 
+/* 페이로드 리틀 엔디언 필드 읽기 (정렬 무관) */
+static inline uint16_t ubx_u2(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t ubx_u4(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+#define ubx_i1(p) ((int8_t)(p)[0])
+#define ubx_i2(p) ((int16_t)ubx_u2(p))
+#define ubx_i4(p) ((int32_t)ubx_u4(p))
+
+/**
+ * @brief NAV-HPPOSLLH 디코딩 및 통합 항법해 병합
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_ubx_nav_hpposllh(gps_t *gps, const uint8_t *p) {
+  gps_ubx_nav_hpposllh_t *hp = &gps->ubx_data.hpposllh;
+
+  if (gps->ubx.len < 36) {
+    return;
+  }
+
+  // 이전 에포크가 늦게 내보내질 수 있으므로 hp를 덮어쓰기 전에 시작
+  // (GPS_EVENT_SOLUTION 핸들러가 hp를 해당 에포크 값으로 읽음)
+  gps_sol_begin(gps, GPS_SOL_SRC_UBX_HPPOSLLH,
+                gps_sol_gps_tow_to_tod(ubx_u4(&p[4])));
+
+  hp->version = p[0];
+  hp->flag = p[3];
+  hp->tow = ubx_u4(&p[4]);
+  hp->lon = ubx_i4(&p[8]);
+  hp->lat = ubx_i4(&p[12]);
+  hp->height = ubx_i4(&p[16]);
+  hp->msl = ubx_i4(&p[20]);
+  hp->lon_hp = ubx_i1(&p[24]);
+  hp->lat_hp = ubx_i1(&p[25]);
+  hp->height_hp = ubx_i1(&p[26]);
+  hp->msl_hp = ubx_i1(&p[27]);
+  hp->hacc = ubx_u4(&p[28]);
+  hp->vacc = ubx_u4(&p[32]);
+
+  _gps_nav_publish(gps, GPS_PROTOCOL_UBX);
+
+  // bit0: invalidLlh
+  if (!(hp->flag & 0x01)) {
+    gps_sol_set_pos(gps, GPS_SOL_SRC_UBX_HPPOSLLH,
+                    (hp->lat * 100.0 + hp->lat_hp) * 1e-9,
+                    (hp->lon * 100.0 + hp->lon_hp) * 1e-9,
+                    (hp->height * 10.0 + hp->height_hp) * 1e-4,
+                    (hp->msl * 10.0 + hp->msl_hp) * 1e-4);
+    gps_sol_set_acc(gps, GPS_SOL_SRC_UBX_HPPOSLLH, hp->hacc * 1e-4f,
+                    hp->vacc * 1e-4f);
+  }
+
+  gps_sol_end(gps, GPS_SOL_SRC_UBX_HPPOSLLH);
+}
+
+/**
+ * @brief NAV-PVT 디코딩 및 통합 항법해 병합
+ *
+ * 시각/위치/정확도/fix/위성 수는 프레임에서 바로 항법해로 넣고,
+ * 항법해에 없는 속도/방향만 pvt에 남긴다.
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_ubx_nav_pvt(gps_t *gps, const uint8_t *p) {
+  gps_ubx_nav_pvt_t *pvt = &gps->ubx_data.pvt;
+  const gps_sol_src_t src = GPS_SOL_SRC_UBX_NAV_PVT;
+  uint8_t flags;
+  gps_fix_t fix;
+
+  if (gps->ubx.len < 92) {
+    return;
+  }
+
+  flags = p[21];
+  pvt->tow = ubx_u4(&p[0]);
+  pvt->fix_type = p[20];
+  pvt->carr_soln = (flags >> 6) & 0x03;
+  pvt->vel_n = ubx_i4(&p[48]);
+  pvt->vel_e = ubx_i4(&p[52]);
+  pvt->vel_d = ubx_i4(&p[56]);
+  pvt->g_speed = ubx_i4(&p[60]);
+  pvt->head_mot = ubx_i4(&p[64]);
+  pvt->s_acc = ubx_u4(&p[68]);
+  pvt->pdop = ubx_u2(&p[76]);
+
+  // GGA quality와 같은 의미로 변환
+  if (!(flags & 0x01) || pvt->fix_type == 0 || pvt->fix_type == 5) {
+    fix = GPS_FIX_INVALID;
+  } else if (pvt->fix_type == 1) {
+    fix = GPS_FIX_DR;
+  } else if (pvt->carr_soln == 2) {
+    fix = GPS_FIX_RTK_FIX;
+  } else if (pvt->carr_soln == 1) {
+    fix = GPS_FIX_RTK_FLOAT;
+  } else if (flags & 0x02) {
+    fix = GPS_FIX_DGPS;
+  } else {
+    fix = GPS_FIX_GPS;
+  }
+
+  gps_sol_begin(gps, src, gps_sol_gps_tow_to_tod(pvt->tow));
+
+  gps_sol_set_fix(gps, src, fix);
+  gps_sol_set_sats(gps, src, p[23]);
+
+  if (fix != GPS_FIX_INVALID) {
+    gps_sol_set_pos(gps, src, ubx_i4(&p[28]) * 1e-7, ubx_i4(&p[24]) * 1e-7,
+                    ubx_i4(&p[32]) * 1e-3, ubx_i4(&p[36]) * 1e-3);
+    gps_sol_set_acc(gps, src, ubx_u4(&p[40]) * 1e-3f, ubx_u4(&p[44]) * 1e-3f);
+  }
+
+  gps_sol_end(gps, src);
+}
+
+/**
+ * @brief NAV-RELPOSNED 디코딩 (version 1, F9)
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_ubx_nav_relposned(gps_t *gps, const uint8_t *p) {
+  gps_ubx_nav_relposned_t *rel = &gps->ubx_data.relposned;
+  const gps_sol_src_t src = GPS_SOL_SRC_UBX_RELPOSNED;
+
+  if (gps->ubx.len < 64 || p[0] != 0x01) {
+    return;
+  }
+
+  rel->ref_station = ubx_u2(&p[2]);
+  rel->tow = ubx_u4(&p[4]);
+  // cm 값 + 0.1mm 고정밀 값
+  rel->rel_n = ubx_i4(&p[8]) * 100 + ubx_i1(&p[32]);
+  rel->rel_e = ubx_i4(&p[12]) * 100 + ubx_i1(&p[33]);
+  rel->rel_d = ubx_i4(&p[16]) * 100 + ubx_i1(&p[34]);
+  rel->length = ubx_i4(&p[20]) * 100 + ubx_i1(&p[35]);
+  rel->heading = ubx_i4(&p[24]);
+  rel->acc_n = ubx_u4(&p[36]);
+  rel->acc_e = ubx_u4(&p[40]);
+  rel->acc_d = ubx_u4(&p[44]);
+  rel->acc_length = ubx_u4(&p[48]);
+  rel->acc_heading = ubx_u4(&p[52]);
+  rel->flags = ubx_u4(&p[60]);
+  rel->carr_soln = (rel->flags >> 3) & 0x03;
+  rel->rel_pos_valid = (rel->flags >> 2) & 0x01;
+  rel->heading_valid = (rel->flags >> 8) & 0x01;
+
+  gps_sol_begin(gps, src, gps_sol_gps_tow_to_tod(rel->tow));
+
+  if (rel->heading_valid) {
+    gps_sol_set_heading(gps, src, rel->heading * 1e-5f,
+                        rel->acc_heading * 1e-5f);
+  }
+
+  gps_sol_end(gps, src);
+}
+
+/**
+ * @brief NAV-SAT 디코딩
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_ubx_nav_sat(gps_t *gps, const uint8_t *p) {
+  gps_ubx_nav_sat_t *sat = &gps->ubx_data.sat;
+  uint32_t cno_sum = 0;
+  uint8_t num;
+
+  if (gps->ubx.len < 8) {
+    return;
+  }
+
+  num = p[5];
+  if (gps->ubx.len < 8u + 12u * num) {
+    return;
+  }
+
+  sat->tow = ubx_u4(&p[0]);
+  sat->num_svs = num;
+  sat->num_used = 0;
+  sat->sat_cnt = 0;
+  memset(sat->used_by_gnss, 0, sizeof(sat->used_by_gnss));
+
+  for (uint8_t i = 0; i < num; i++) {
+    const uint8_t *b = &p[8 + 12 * i];
+    uint32_t flags = ubx_u4(&b[8]);
+    bool used = (flags >> 3) & 0x01;
+
+    if (used) {
+      sat->num_used++;
+      cno_sum += b[2];
+      if (b[0] < sizeof(sat->used_by_gnss)) {
+        sat->used_by_gnss[b[0]]++;
+      }
+    }
+
+    if (sat->sat_cnt < GPS_UBX_SAT_MAX) {
+      gps_ubx_sat_t *sv = &sat->sats[sat->sat_cnt++];
+
+      sv->gnss_id = b[0];
+      sv->sv_id = b[1];
+      sv->cno = b[2];
+      sv->elev = ubx_i1(&b[3]);
+      sv->azim = ubx_i2(&b[4]);
+      sv->quality = flags & 0x07;
+      sv->used = used;
+    }
+  }
+
+  sat->cno_avg = sat->num_used ? (uint8_t)(cno_sum / sat->num_used) : 0;
+}
+
+/**
+ * @brief RXM-RTCM 디코딩 (보정 메시지 타입별 사용 여부 누적)
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_ubx_rxm_rtcm(gps_t *gps, const uint8_t *p) {
+  gps_ubx_rxm_rtcm_t *rtcm = &gps->ubx_data.rtcm;
+  gps_ubx_rtcm_stat_t *st = NULL;
+  uint16_t sub_type, msg_type;
+  uint8_t flags;
+
+  if (gps->ubx.len < 8) {
+    return;
+  }
+
+  flags = p[1];
+  sub_type = ubx_u2(&p[2]);
+  msg_type = ubx_u2(&p[6]);
+
+  for (uint8_t i = 0; i < rtcm->cnt; i++) {
+    if (rtcm->stat[i].msg_type == msg_type &&
+        rtcm->stat[i].sub_type == sub_type) {
+      st = &rtcm->stat[i];
+      break;
+    }
+  }
+
+  if (!st) {
+    if (rtcm->cnt >= GPS_UBX_RTCM_STAT_MAX) {
+      rtcm->overflow++;
+      return;
+    }
+    st = &rtcm->stat[rtcm->cnt++];
+    memset(st, 0, sizeof(*st));
+    st->msg_type = msg_type;
+    st->sub_type = sub_type;
+  }
+
+  if (flags & 0x01) {
+    st->crc_fail++;
+    return;
+  }
+
+  switch ((flags >> 1) & 0x03) {
+  case 1:
+    st->unused++;
+    break;
+  case 2:
+    st->used++;
+    break;
+  default:
+    st->unknown++;
+    break;
+  }
+}
+
+/**
+ * @brief RXM-RTCM 메시지 타입별 통계 조회
+ *
+ * @param[in] gps
+ * @param[in] msg_type RTCM 메시지 타입
+ * @return const gps_ubx_rtcm_stat_t* 통계 (하위 타입 구분 없이 첫 항목), 없으면 NULL
+ */
+const gps_ubx_rtcm_stat_t *gps_ubx_get_rtcm_stat(const gps_t *gps,
+                                                 uint16_t msg_type) {
+  const gps_ubx_rxm_rtcm_t *rtcm = &gps->ubx_data.rtcm;
+
+  for (uint8_t i = 0; i < rtcm->cnt; i++) {
+    if (rtcm->stat[i].msg_type == msg_type) {
+      return &rtcm->stat[i];
+    }
+  }
+
+  return NULL;
+}
+
 /**
  * @brief 파싱한 ubx nav 프토토콜 데이터 저장
  *
+ * 페이로드 필드를 프레임 버퍼에서 바로 읽는다.
+ *
  * @param[inout] gps
  */
 static void store_ubx_nav_data(gps_t *gps) {
+  const uint8_t *p = (const uint8_t *)&gps->payload[4];
+
   switch (gps->ubx.id) {
+  case GPS_UBX_NAV_ID_PVT:
+    decode_ubx_nav_pvt(gps, p);
+    break;
+
   case GPS_UBX_NAV_ID_HPPOSLLH:
-    memcpy(&gps->ubx_data.hpposllh, &gps->payload[4],
-           sizeof(gps_ubx_nav_hpposllh_t));
+    decode_ubx_nav_hpposllh(gps, p);
+    break;
+
+  case GPS_UBX_NAV_ID_SAT:
+    decode_ubx_nav_sat(gps, p);
+    break;
+
+  case GPS_UBX_NAV_ID_RELPOSNED:
+    decode_ubx_nav_relposned(gps, p);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief 파싱한 ubx rxm 프토토콜 데이터 저장
+ *
+ * @param[inout] gps
+ */
+static void store_ubx_rxm_data(gps_t *gps) {
+  const uint8_t *p = (const uint8_t *)&gps->payload[4];
+
+  switch (gps->ubx.id) {
+  case GPS_UBX_RXM_ID_RTCM:
+    decode_ubx_rxm_rtcm(gps, p);
     break;
 
   default:
@@ -68,6 +398,10 @@ static void store_ubx_data(gps_t *gps) {
     store_ubx_nav_data(gps);
     break;
 
+  case GPS_UBX_CLASS_RXM:
+    store_ubx_rxm_data(gps);
+    break;
+
   default:
     break;
   }
@@ -76,46 +410,180 @@ static void store_ubx_data(gps_t *gps) {
 /**
  * @brief ubx 프로토콜 파싱
  *
+ * sync(0xB5 0x62) 이후의 바이트를 받는다. class, id, len 4바이트 헤더가
+ * 모이면 남은 페이로드와 체크섬은 길이만큼 한번에 복사한다.
+ * 청크 경계에 걸친 프레임은 다음 호출에서 이어서 처리한다.
+ *
  * @param[inout] gps
- * @return uint8_t 1: success 0: checksum mismatch
+ * @param[in] data
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
  */
-uint8_t gps_parse_ubx(gps_t *gps) {
-  if (gps->pos == 1) {
-    gps->ubx.class = gps->payload[0];
-    gps->state = GPS_PARSE_STATE_UBX_MSG_CLASS;
-  } else if (gps->pos == 2) {
-    gps->ubx.id = gps->payload[1];
-    gps->state = GPS_PARSE_STATE_UBX_MSG_ID;
-  } else if (gps->pos == 4) {
-    gps->ubx.len = (gps->payload[2] | ((gps->payload[3] << 8)));
-    gps->state = GPS_PARSE_STATE_UBX_LEN;
-  } else {
-    if (gps->pos <= 4 + gps->ubx.len) {
+size_t gps_parse_ubx(gps_t *gps, const uint8_t *data, size_t len) {
+  size_t i = 0;
+  size_t n;
+  uint32_t total;
+
+  while (gps->pos < 4 && i < len) {
+    gps->payload[gps->pos++] = data[i++];
+
+    if (gps->pos == 4) {
+      gps->ubx.class = gps->payload[0];
+      gps->ubx.id = gps->payload[1];
+      gps->ubx.len = (gps->payload[2] | ((gps->payload[3] << 8)));
       gps->state = GPS_PARSE_STATE_UBX_PAYLOAD;
-    } else if (gps->pos == 5 + gps->ubx.len) {
-      gps->state = GPS_PARSE_STATE_UBX_CHKSUM_A;
-      gps->ubx.chksum_a = gps->payload[4 + gps->ubx.len];
-    } else if (gps->pos == 6 + gps->ubx.len) {
-      gps->state = GPS_PARSE_STATE_UBX_CHKSUM_B;
-      gps->ubx.chksum_b = gps->payload[5 + gps->ubx.len];
-
-      if (check_ubx_chksum(gps)) {
-        store_ubx_data(gps);
-        gps_msg_t msg;
-        msg.ubx.class = gps->ubx.class;
-        msg.ubx.id = gps->ubx.id;
-        gps->handler(gps, GPS_EVENT_NONE, GPS_PROTOCOL_UBX, msg);
-        gps->protocol = GPS_PROTOCOL_NONE;
-        gps->state = GPS_PARSE_STATE_NONE;
 
-        return 1;
-      } else {
+      /* 버퍼보다 큰 프레임은 버리고 sync 부터 다시 찾는다 */
+      if (gps->ubx.len + 6 > GPS_PAYLOAD_SIZE) {
         gps->protocol = GPS_PROTOCOL_NONE;
         gps->state = GPS_PARSE_STATE_NONE;
-        return 0;
+        return i;
       }
     }
   }
 
-  return 1;
+  if (gps->pos < 4) {
+    return i;
+  }
+
+  total = 4 + gps->ubx.len + 2;
+  n = total - gps->pos;
+  if (n > len - i) {
+    n = len - i;
+  }
+
+  memcpy(&gps->payload[gps->pos], &data[i], n);
+  gps->pos += n;
+  i += n;
+
+  if (gps->pos < total) {
+    return i;
+  }
+
+  gps->ubx.chksum_a = gps->payload[4 + gps->ubx.len];
+  gps->ubx.chksum_b = gps->payload[5 + gps->ubx.len];
+  gps->protocol = GPS_PROTOCOL_NONE;
+  gps->state = GPS_PARSE_STATE_NONE;
+
+  if (check_ubx_chksum(gps)) {
+    store_ubx_data(gps);
+
+    if (gps->handler) {
+      gps_msg_t msg;
+      msg.ubx.class = gps->ubx.class;
+      msg.ubx.id = gps->ubx.id;
+      gps->handler(gps, GPS_EVENT_NONE, GPS_PROTOCOL_UBX, msg);
+    }
+  }
+
+  return i;
+}
+
+/**
+ * @brief CFG 키의 값 크기
+ *
+ * @param[in] key 설정 키
+ * @return uint8_t 바이트 수, 알 수 없으면 0
+ */
+static uint8_t gps_ubx_cfg_key_size(uint32_t key) {
+  switch ((key >> 28) & 0x07) {
+  case 1: // L (1비트지만 1바이트로 전송)
+  case 2:
+    return 1;
+  case 3:
+    return 2;
+  case 4:
+    return 4;
+  case 5:
+    return 8;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief UBX-CFG-VALSET 프레임 생성
+ *
+ * sync, 헤더, 체크섬을 포함한 전송 가능한 프레임을 만든다.
+ *
+ * @param[out] buf 출력 버퍼
+ * @param[in] size 버퍼 크기
+ * @param[in] layers 적용 레이어 (GPS_UBX_CFG_LAYER_*)
+ * @param[in] kv 키/값 목록
+ * @param[in] cnt 키/값 개수 (최대 64)
+ * @return size_t 프레임 길이, 버퍼가 작거나 키가 잘못되면 0
+ */
+size_t gps_ubx_make_cfg_valset(uint8_t *buf, size_t size, uint8_t layers,
+                               const gps_ubx_cfg_kv_t *kv, size_t cnt) {
+  uint16_t plen = 4;
+  uint8_t ck_a = 0;
+  uint8_t ck_b = 0;
+  size_t n = 0;
+
+  if (!buf || !kv || cnt == 0 || cnt > 64) {
+    return 0;
+  }
+
+  for (size_t k = 0; k < cnt; k++) {
+    uint8_t vlen = gps_ubx_cfg_key_size(kv[k].key);
+
+    if (vlen == 0) {
+      return 0;
+    }
+    plen += 4 + vlen;
+  }
+
+  if (size < 8u + plen) {
+    return 0;
+  }
+
+  buf[n++] = 0xB5;
+  buf[n++] = 0x62;
+  buf[n++] = GPS_UBX_CLASS_CFG;
+  buf[n++] = GPS_UBX_CFG_ID_VALSET;
+  buf[n++] = plen & 0xFF;
+  buf[n++] = plen >> 8;
+
+  buf[n++] = 0x00; // version
+  buf[n++] = layers;
+  buf[n++] = 0x00; // reserved
+  buf[n++] = 0x00;
+
+  for (size_t k = 0; k < cnt; k++) {
+    uint8_t vlen = gps_ubx_cfg_key_size(kv[k].key);
+
+    for (int i = 0; i < 4; i++) {
+      buf[n++] = (kv[k].key >> (8 * i)) & 0xFF;
+    }
+    for (int i = 0; i < vlen; i++) {
+      buf[n++] = (kv[k].val >> (8 * i)) & 0xFF;
+    }
+  }
+
+  for (size_t i = 2; i < n; i++) {
+    ck_a += buf[i];
+    ck_b += ck_a;
+  }
+
+  buf[n++] = ck_a;
+  buf[n++] = ck_b;
+
+  return n;
+}
+
+/**
+ * @brief UBX-CFG-VALSET 프레임 생성 (U4 값 1개)
+ *
+ * @param[out] buf 출력 버퍼
+ * @param[in] size 버퍼 크기 (20바이트 이상)
+ * @param[in] layers 적용 레이어 (GPS_UBX_CFG_LAYER_*)
+ * @param[in] key 설정 키
+ * @param[in] val 설정 값
+ * @return size_t 프레임 길이, 버퍼가 작으면 0
+ */
+size_t gps_ubx_make_cfg_valset_u4(uint8_t *buf, size_t size, uint8_t layers,
+                                  uint32_t key, uint32_t val) {
+  const gps_ubx_cfg_kv_t kv = {.key = key, .val = val};
+
+  return gps_ubx_make_cfg_valset(buf, size, layers, &kv, 1);
 }
@@ -2,7 +2,19 @@
 #define GPS_UBX_H
 
 #include "gps_types.h"
+#include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
+
+/* NAV-SAT 위성 목록 최대 개수 (넘는 위성은 요약에만 반영) */
+#ifndef GPS_UBX_SAT_MAX
+#define GPS_UBX_SAT_MAX 64
+#endif
+
+/* RXM-RTCM 메시지 타입별 통계 항목 수 */
+#ifndef GPS_UBX_RTCM_STAT_MAX
+#define GPS_UBX_RTCM_STAT_MAX 24
+#endif
 
 /**
  * @brief ubx 프로토콜 클래스 타입
@@ -11,6 +23,8 @@
 typedef enum {
   GPS_UBX_CLASS_NONE = 0,
   GPS_UBX_CLASS_NAV = 0x01,
+  GPS_UBX_CLASS_RXM = 0x02,
+  GPS_UBX_CLASS_CFG = 0x06,
 } gps_ubx_class_t;
 
 /**
@@ -19,9 +33,61 @@ typedef enum {
  */
 typedef enum {
   GPS_UBX_NAV_ID_NONE = 0,
+  GPS_UBX_NAV_ID_PVT = 0x07,
   GPS_UBX_NAV_ID_HPPOSLLH = 0x14,
+  GPS_UBX_NAV_ID_SAT = 0x35,
+  GPS_UBX_NAV_ID_RELPOSNED = 0x3C,
 } gps_ubx_nav_id_t;
 
+/**
+ * @brief ubx 프로토콜 RXM 클래스 메시지 id
+ *
+ */
+typedef enum {
+  GPS_UBX_RXM_ID_RTCM = 0x32,
+} gps_ubx_rxm_id_t;
+
+/**
+ * @brief ubx 프로토콜 CFG 클래스 메시지 id
+ *
+ */
+typedef enum {
+  GPS_UBX_CFG_ID_VALSET = 0x8A,
+} gps_ubx_cfg_id_t;
+
+/* CFG-VALSET 적용 레이어 */
+#define GPS_UBX_CFG_LAYER_RAM 0x01
+#define GPS_UBX_CFG_LAYER_BBR 0x02
+#define GPS_UBX_CFG_LAYER_FLASH 0x04
+
+/* 설정 키 (U4) */
+#define GPS_UBX_CFG_KEY_UART1_BAUDRATE 0x40520001UL
+
+/* 설정 키: 시간 모드 (베이스 고정 좌표) */
+#define GPS_UBX_CFG_KEY_TMODE_MODE 0x20030001UL      // U1 (0: 끔, 1: survey-in, 2: 고정)
+#define GPS_UBX_CFG_KEY_TMODE_POS_TYPE 0x20030002UL  // U1 (0: ECEF, 1: LLH)
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_X 0x40030003UL    // I4 [cm]
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_Y 0x40030004UL    // I4 [cm]
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_Z 0x40030005UL    // I4 [cm]
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_X_HP 0x20030006UL // I1 [0.1mm]
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_Y_HP 0x20030007UL // I1 [0.1mm]
+#define GPS_UBX_CFG_KEY_TMODE_ECEF_Z_HP 0x20030008UL // I1 [0.1mm]
+#define GPS_UBX_CFG_KEY_TMODE_FIXED_POS_ACC 0x4003000FUL // U4 [0.1mm]
+
+#define GPS_UBX_TMODE_DISABLED 0
+#define GPS_UBX_TMODE_SURVEY_IN 1
+#define GPS_UBX_TMODE_FIXED 2
+
+/**
+ * @brief CFG-VALSET 키/값 쌍
+ *
+ * 값 크기는 키의 size 필드(bit 28..30)로 정해진다.
+ */
+typedef struct {
+  uint32_t key;
+  uint64_t val;
+} gps_ubx_cfg_kv_t;
+
 /**
  * @brief ubx 프로토콜 NAV 클래스 HPPOSLLH 메시지
  *
@@ -43,6 +109,98 @@ typedef struct {
   uint32_t vacc;    // 0.1mm 단위
 } gps_ubx_nav_hpposllh_t;
 
+/**
+ * @brief ubx 프로토콜 NAV 클래스 PVT 메시지 (통합 항법해에 없는 필드)
+ *
+ * 시각/위치/정확도/fix/위성 수는 프레임에서 바로 통합 항법해로 들어간다.
+ */
+typedef struct {
+  uint32_t tow;       // time of week [ms]
+  uint8_t fix_type;   // 0: no fix, 1: DR, 2: 2D, 3: 3D, 4: GNSS+DR, 5: time
+  uint8_t carr_soln;  // 0: 없음, 1: float, 2: fixed
+  int32_t vel_n;      // [mm/s]
+  int32_t vel_e;      // [mm/s]
+  int32_t vel_d;      // [mm/s]
+  int32_t g_speed;    // 지면 속도 [mm/s]
+  int32_t head_mot;   // 진행 방향 [1e-5 deg]
+  uint32_t s_acc;     // 속도 정확도 [mm/s]
+  uint16_t pdop;      // [0.01]
+} gps_ubx_nav_pvt_t;
+
+/**
+ * @brief ubx 프로토콜 NAV 클래스 RELPOSNED 메시지 (moving base)
+ *
+ */
+typedef struct {
+  uint32_t tow;         // time of week [ms]
+  uint16_t ref_station;
+  int32_t rel_n;        // [0.1mm]
+  int32_t rel_e;        // [0.1mm]
+  int32_t rel_d;        // [0.1mm]
+  int32_t length;       // 기선 길이 [0.1mm]
+  int32_t heading;      // [1e-5 deg]
+  uint32_t acc_n;       // [0.1mm]
+  uint32_t acc_e;       // [0.1mm]
+  uint32_t acc_d;       // [0.1mm]
+  uint32_t acc_length;  // [0.1mm]
+  uint32_t acc_heading; // [1e-5 deg]
+  uint32_t flags;       // 원본 flags
+  uint8_t carr_soln;    // 0: 없음, 1: float, 2: fixed
+  bool rel_pos_valid;
+  bool heading_valid;
+} gps_ubx_nav_relposned_t;
+
+/**
+ * @brief ubx 프로토콜 NAV 클래스 SAT 메시지 위성 1개
+ *
+ */
+typedef struct {
+  uint8_t gnss_id;
+  uint8_t sv_id;
+  uint8_t cno;      // [dBHz]
+  int8_t elev;      // [deg]
+  int16_t azim;     // [deg]
+  uint8_t quality;  // 0 ~ 7
+  bool used;        // 항법해에 사용됨
+} gps_ubx_sat_t;
+
+/**
+ * @brief ubx 프로토콜 NAV 클래스 SAT 메시지
+ *
+ */
+typedef struct {
+  uint32_t tow;        // time of week [ms]
+  uint8_t num_svs;     // 메시지의 위성 수
+  uint8_t num_used;    // 항법해에 사용된 위성 수
+  uint8_t cno_avg;     // 사용 위성 평균 C/N0 [dBHz]
+  uint8_t used_by_gnss[8];  // gnssId별 사용 위성 수
+  uint8_t sat_cnt;     // sats[]에 담긴 수 (최대 GPS_UBX_SAT_MAX)
+  gps_ubx_sat_t sats[GPS_UBX_SAT_MAX];
+} gps_ubx_nav_sat_t;
+
+/**
+ * @brief RXM-RTCM 메시지 타입별 사용 통계
+ *
+ */
+typedef struct {
+  uint16_t msg_type;
+  uint16_t sub_type;   // 4072 등 하위 타입
+  uint32_t used;       // 수신기가 사용함
+  uint32_t unused;     // 수신했지만 사용 안 함
+  uint32_t unknown;    // 사용 여부 미보고
+  uint32_t crc_fail;
+} gps_ubx_rtcm_stat_t;
+
+/**
+ * @brief RXM-RTCM 통계
+ *
+ */
+typedef struct {
+  uint8_t cnt;
+  uint32_t overflow;   // 표가 가득 차 못 넣은 메시지 수
+  gps_ubx_rtcm_stat_t stat[GPS_UBX_RTCM_STAT_MAX];
+} gps_ubx_rxm_rtcm_t;
+
 /**
  * @brief UBX 파싱에 필요한 변수
  *
@@ -64,10 +222,20 @@ typedef struct {
  */
 typedef struct {
   gps_ubx_nav_hpposllh_t hpposllh;
+  gps_ubx_nav_pvt_t pvt;
+  gps_ubx_nav_relposned_t relposned;
+  gps_ubx_nav_sat_t sat;
+  gps_ubx_rxm_rtcm_t rtcm;
 } gps_ubx_data_t;
 
 typedef struct gps_s gps_t;
 
-uint8_t gps_parse_ubx(gps_t *gps);
+size_t gps_parse_ubx(gps_t *gps, const uint8_t *data, size_t len);
+const gps_ubx_rtcm_stat_t *gps_ubx_get_rtcm_stat(const gps_t *gps,
+                                                 uint16_t msg_type);
+size_t gps_ubx_make_cfg_valset(uint8_t *buf, size_t size, uint8_t layers,
+                               const gps_ubx_cfg_kv_t *kv, size_t cnt);
+size_t gps_ubx_make_cfg_valset_u4(uint8_t *buf, size_t size, uint8_t layers,
+                                  uint32_t key, uint32_t val);
 
 #endif
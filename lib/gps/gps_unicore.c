@@ -1,6 +1,7 @@
 #include "gps_unicore.h"
 #include "gps.h"
 #include "gps_parse.h"
+#include <math.h>
 #include <string.h>
 
 static void parse_unicore_command(gps_t *gps);
@@ -85,114 +86,457 @@ uint8_t gps_parse_unicore_term(gps_t *gps) {
   return 1;
 }
 
+/* CRC32 (reflected 0xEDB88320, 초기값 0, 최종 XOR 없음) 바이트 테이블 */
+static const uint32_t CRC32_TABLE[256] = {
+  0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F,
+  0xE963A535, 0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988,
+  0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91, 0x1DB71064, 0x6AB020F2,
+  0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+  0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9,
+  0xFA0F3D63, 0x8D080DF5, 0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172,
+  0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B, 0x35B5A8FA, 0x42B2986C,
+  0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+  0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423,
+  0xCFBA9599, 0xB8BDA50F, 0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924,
+  0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D, 0x76DC4190, 0x01DB7106,
+  0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+  0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D,
+  0x91646C97, 0xE6635C01, 0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E,
+  0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457, 0x65B0D9C6, 0x12B7E950,
+  0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+  0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7,
+  0xA4D1C46D, 0xD3D6F4FB, 0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0,
+  0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9, 0x5005713C, 0x270241AA,
+  0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+  0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81,
+  0xB7BD5C3B, 0xC0BA6CAD, 0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A,
+  0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683, 0xE3630B12, 0x94643B84,
+  0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+  0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB,
+  0x196C3671, 0x6E6B06E7, 0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
+  0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5, 0xD6D6A3E8, 0xA1D1937E,
+  0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+  0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55,
+  0x316E8EEF, 0x4669BE79, 0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236,
+  0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F, 0xC5BA3BBE, 0xB2BD0B28,
+  0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+  0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F,
+  0x72076785, 0x05005713, 0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38,
+  0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21, 0x86D3D2D4, 0xF1D4E242,
+  0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+  0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69,
+  0x616BFFD3, 0x166CCF45, 0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2,
+  0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB, 0xAED16A4A, 0xD9D65ADC,
+  0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+  0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693,
+  0x54DE5729, 0x23D967BF, 0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94,
+  0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+
+_Static_assert(GPS_UNICORE_BIN_HEADER_SIZE + GPS_UNICORE_BIN_MAX_PAYLOAD <= GPS_PAYLOAD_SIZE,
+               "GPS_PAYLOAD_SIZE too small for Unicore binary frames");
+
+static inline uint16_t uc_u2(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t uc_u4(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+
+/* 리틀 엔디언 IEEE754 (Cortex-M4와 같은 바이트 순서) */
+static inline float uc_r4(const uint8_t *p) {
+  float v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static inline double uc_r8(const uint8_t *p) {
+  double v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
 /**
- * @brief Unicore 바이너리 CRC32 계산
+ * @brief Unicore 바이너리 CRC32 누적 계산
+ *
+ * @param crc 이전 CRC (처음은 0)
+ * @param data 데이터
+ * @param len 길이
+ * @return 갱신된 CRC
  */
-static uint32_t calculate_crc32(const uint8_t* data, size_t len) {
-  uint32_t crc = 0;
-
-  for (size_t i = 0; i < len; i++) {
-    crc ^= data[i];
-    for (int j = 0; j < 8; j++) {
-      if (crc & 1) {
-        crc = (crc >> 1) ^ 0xEDB88320;
-      } else {
-        crc >>= 1;
-      }
-    }
+uint32_t gps_unicore_crc32_update(uint32_t crc, const uint8_t *data, size_t len) {
+  while (len--) {
+    crc = CRC32_TABLE[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
   }
 
   return crc;
 }
 
+/**
+ * @brief 헤더 시각을 UTC 하루 중 시각으로 변환
+ *
+ * @param[in] hdr 헤더
+ * @return uint32_t UTC 하루 중 시각 [ms]
+ */
+static uint32_t unicore_bin_tod(const gps_unicore_bin_header_t *hdr) {
+  uint32_t tow = hdr->tow_ms;
+
+  // BDT는 GPST보다 14초 늦음
+  if (hdr->time_ref == 1) {
+    tow += 14000;
+  }
+
+  return gps_sol_gps_tow_to_tod(tow);
+}
+
+/**
+ * @brief 해 상태/위치 타입을 GGA quality와 같은 의미로 변환
+ */
+static gps_fix_t unicore_pos_to_fix(uint32_t sol_status, uint32_t pos_type) {
+  if (sol_status != 0) {
+    return GPS_FIX_INVALID;
+  }
+
+  switch (pos_type) {
+  case GPS_UNICORE_POS_NONE:
+    return GPS_FIX_INVALID;
+
+  case GPS_UNICORE_POS_PSRDIFF:
+  case GPS_UNICORE_POS_SBAS:
+    return GPS_FIX_DGPS;
+
+  case GPS_UNICORE_POS_PROPAGATED:
+    return GPS_FIX_DR;
+
+  case GPS_UNICORE_POS_L1_FLOAT:
+  case GPS_UNICORE_POS_IONOFREE_FLOAT:
+  case GPS_UNICORE_POS_NARROW_FLOAT:
+    return GPS_FIX_RTK_FLOAT;
+
+  case GPS_UNICORE_POS_L1_INT:
+  case GPS_UNICORE_POS_WIDE_INT:
+  case GPS_UNICORE_POS_NARROW_INT:
+    return GPS_FIX_RTK_FIX;
+
+  default:
+    return GPS_FIX_GPS;
+  }
+}
+
+/**
+ * @brief BESTNAV/ADRNAV 위치 부분 디코딩 및 통합 항법해 병합
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ * @param[out] nav 저장할 구조체
+ * @param[in] src 항법해 출처
+ */
+static void decode_unicore_bestnav(gps_t *gps, const uint8_t *p,
+                                   gps_unicore_bestnav_t *nav,
+                                   gps_sol_src_t src) {
+  const gps_unicore_bin_header_t *hdr = &gps->unicore_bin.header;
+  gps_fix_t fix;
+
+  if (hdr->msg_len < 72) {
+    return;
+  }
+
+  nav->week = hdr->week;
+  nav->tow_ms = hdr->tow_ms;
+  nav->sol_status = uc_u4(&p[0]);
+  nav->pos_type = uc_u4(&p[4]);
+  nav->lat = uc_r8(&p[8]);
+  nav->lon = uc_r8(&p[16]);
+  nav->hgt = uc_r8(&p[24]);
+  nav->undulation = uc_r4(&p[32]);
+  nav->lat_std = uc_r4(&p[40]);
+  nav->lon_std = uc_r4(&p[44]);
+  nav->hgt_std = uc_r4(&p[48]);
+  nav->diff_age = uc_r4(&p[56]);
+  nav->svs = p[64];
+  nav->soln_svs = p[65];
+
+  fix = unicore_pos_to_fix(nav->sol_status, nav->pos_type);
+
+  gps_sol_begin(gps, src, unicore_bin_tod(hdr));
+
+  gps_sol_set_fix(gps, src, fix);
+  gps_sol_set_sats(gps, src, nav->soln_svs);
+
+  if (fix != GPS_FIX_INVALID) {
+    gps_sol_set_pos(gps, src, nav->lat, nav->lon,
+                    nav->hgt + nav->undulation, nav->hgt);
+    gps_sol_set_acc(gps, src,
+                    sqrtf(nav->lat_std * nav->lat_std + nav->lon_std * nav->lon_std),
+                    nav->hgt_std);
+  }
+
+  gps_sol_end(gps, src);
+}
+
+/**
+ * @brief PVTSLN 디코딩 및 통합 항법해 병합
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_unicore_pvtsln(gps_t *gps, const uint8_t *p) {
+  const gps_unicore_bin_header_t *hdr = &gps->unicore_bin.header;
+  gps_unicore_pvtsln_t *pvt = &gps->unicore_data.pvtsln;
+  const gps_sol_src_t src = GPS_SOL_SRC_UNICORE_PVTSLN;
+  gps_fix_t fix;
+
+  if (hdr->msg_len < 140) {
+    return;
+  }
+
+  pvt->tow_ms = hdr->tow_ms;
+  pvt->pos_type = uc_u4(&p[0]);
+  pvt->hgt = uc_r4(&p[4]);
+  pvt->lat = uc_r8(&p[8]);
+  pvt->lon = uc_r8(&p[16]);
+  pvt->hgt_std = uc_r4(&p[24]);
+  pvt->lat_std = uc_r4(&p[28]);
+  pvt->lon_std = uc_r4(&p[32]);
+  pvt->diff_age = uc_r4(&p[36]);
+  pvt->undulation = uc_r4(&p[64]);
+  pvt->soln_svs = p[69];
+  pvt->heading_type = uc_u4(&p[96]);
+  pvt->heading_length = uc_r4(&p[100]);
+  pvt->heading = uc_r4(&p[104]);
+  pvt->pitch = uc_r4(&p[108]);
+  pvt->pdop = uc_r4(&p[120]);
+  pvt->hdop = uc_r4(&p[124]);
+
+  fix = unicore_pos_to_fix(0, pvt->pos_type);
+
+  gps_sol_begin(gps, src, unicore_bin_tod(hdr));
+
+  gps_sol_set_fix(gps, src, fix);
+  gps_sol_set_sats(gps, src, pvt->soln_svs);
+  gps_sol_set_dop(gps, src, pvt->hdop);
+
+  if (fix != GPS_FIX_INVALID) {
+    gps_sol_set_pos(gps, src, pvt->lat, pvt->lon,
+                    pvt->hgt + pvt->undulation, pvt->hgt);
+    gps_sol_set_acc(gps, src,
+                    sqrtf(pvt->lat_std * pvt->lat_std + pvt->lon_std * pvt->lon_std),
+                    pvt->hgt_std);
+  }
+
+  if (pvt->heading_type != GPS_UNICORE_POS_NONE) {
+    gps_sol_set_heading(gps, src, pvt->heading, 0.0f);
+  }
+
+  gps_sol_end(gps, src);
+}
+
+/**
+ * @brief UNIHEADING 디코딩 및 통합 항법해 병합
+ *
+ * @param[inout] gps
+ * @param[in] p 페이로드
+ */
+static void decode_unicore_heading(gps_t *gps, const uint8_t *p) {
+  const gps_unicore_bin_header_t *hdr = &gps->unicore_bin.header;
+  gps_unicore_heading_t *hd = &gps->unicore_data.heading;
+  const gps_sol_src_t src = GPS_SOL_SRC_UNICORE_HEADING;
+
+  if (hdr->msg_len < 44) {
+    return;
+  }
+
+  hd->tow_ms = hdr->tow_ms;
+  hd->sol_status = uc_u4(&p[0]);
+  hd->pos_type = uc_u4(&p[4]);
+  hd->length = uc_r4(&p[8]);
+  hd->heading = uc_r4(&p[12]);
+  hd->pitch = uc_r4(&p[16]);
+  hd->heading_std = uc_r4(&p[24]);
+  hd->pitch_std = uc_r4(&p[28]);
+  hd->soln_svs = p[37];
+
+  gps_sol_begin(gps, src, unicore_bin_tod(hdr));
+
+  if (hd->sol_status == 0 && hd->pos_type != GPS_UNICORE_POS_NONE) {
+    gps_sol_set_heading(gps, src, hd->heading, hd->heading_std);
+  }
+
+  gps_sol_end(gps, src);
+}
+
+/**
+ * @brief CRC를 통과한 바이너리 메시지 디코딩
+ *
+ * @param[inout] gps
+ */
+static void decode_unicore_bin(gps_t *gps) {
+  const uint8_t *p = (const uint8_t *)&gps->payload[GPS_UNICORE_BIN_HEADER_SIZE];
+
+  switch (gps->unicore_bin.header.msg_id) {
+  case GPS_UNICORE_BIN_ID_BESTNAV:
+    decode_unicore_bestnav(gps, p, &gps->unicore_data.bestnav,
+                           GPS_SOL_SRC_UNICORE_BESTNAV);
+    break;
+
+  case GPS_UNICORE_BIN_ID_ADRNAV:
+    decode_unicore_bestnav(gps, p, &gps->unicore_data.adrnav,
+                           GPS_SOL_SRC_UNICORE_ADRNAV);
+    break;
+
+  case GPS_UNICORE_BIN_ID_PVTSLN:
+    decode_unicore_pvtsln(gps, p);
+    break;
+
+  case GPS_UNICORE_BIN_ID_UNIHEADING:
+    decode_unicore_heading(gps, p);
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief 24바이트 헤더 해석
+ *
+ * @param[out] hdr
+ * @param[in] p sync부터 시작하는 헤더
+ */
+static void decode_unicore_bin_header(gps_unicore_bin_header_t *hdr,
+                                      const uint8_t *p) {
+  hdr->cpu_idle = p[3];
+  hdr->msg_id = uc_u2(&p[4]);
+  hdr->msg_len = uc_u2(&p[6]);
+  hdr->time_ref = p[8];
+  hdr->time_status = p[9];
+  hdr->week = uc_u2(&p[10]);
+  hdr->tow_ms = uc_u4(&p[12]);
+  hdr->version = p[20];
+  hdr->leap_sec = p[21];
+  hdr->output_delay = uc_u2(&p[22]);
+}
+
+/**
+ * @brief 바이너리 파서를 sync 대기 상태로
+ */
+static void unicore_bin_done(gps_t *gps) {
+  gps->protocol = GPS_PROTOCOL_NONE;
+  gps->state = GPS_PARSE_STATE_NONE;
+  gps->pos = 0;
+}
+
 /**
  * @brief Unicore 바이너리 프로토콜 파싱
  *
- * UBX와 유사한 상태 머신 방식
- * Sync: 0xAA 0x44 0x12
- * Header: 28 bytes
+ * Sync: 0xAA 0x44 0xB5
+ * Header: 24 bytes (sync 포함)
  * Payload: variable
- * CRC: 4 bytes (CRC32)
+ * CRC: 4 bytes (CRC32, sync부터 페이로드 끝까지)
+ *
+ * sync 3바이트는 호출 전에 payload에 저장되어 있어야 한다.
+ * CRC는 들어오는 청크마다 누적하므로 프레임 끝에서 다시 훑지 않는다.
+ * 디코딩하는 메시지만 버퍼에 담고, GPS_UNICORE_BIN_MAX_PAYLOAD보다 긴
+ * 메시지는 CRC만 확인하며 건너뛴다 (프레임 중간에서 sync를 다시 찾지 않음).
  *
  * @param[inout] gps
+ * @param[in] data
+ * @param[in] len
+ * @return size_t 처리한 바이트 수
  */
-void gps_parse_unicore_bin(gps_t *gps) {
-  char ch = gps->payload[gps->pos - 1];  // 방금 추가된 바이트
-
-  switch (gps->state) {
-    case GPS_PARSE_STATE_UNICORE_BIN_SYNC_3:
-      // Sync 완료, 헤더 읽기 시작
-      gps->state = GPS_PARSE_STATE_UNICORE_BIN_HEADER;
-      gps->unicore_bin.header_pos = 0;
-      break;
-
-    case GPS_PARSE_STATE_UNICORE_BIN_HEADER:
-      {
-        // 헤더 28바이트 읽기
-        uint8_t* header_ptr = (uint8_t*)&gps->unicore_bin.header;
-        header_ptr[gps->unicore_bin.header_pos++] = (uint8_t)ch;
-
-        if (gps->unicore_bin.header_pos >= GPS_UNICORE_BIN_HEADER_SIZE) {
-          // 헤더 완료, 페이로드 읽기 시작
-          gps->unicore_bin.payload_pos = 0;
-
-          if (gps->unicore_bin.header.msg_len > 0) {
-            gps->state = GPS_PARSE_STATE_UNICORE_BIN_PAYLOAD;
-          } else {
-            // 페이로드 없음, CRC로
-            gps->state = GPS_PARSE_STATE_UNICORE_BIN_CRC;
-            gps->unicore_bin.crc_pos = 0;
-          }
-        }
-      }
-      break;
+size_t gps_parse_unicore_bin(gps_t *gps, const uint8_t *data, size_t len) {
+  gps_unicore_bin_parser_t *bin = &gps->unicore_bin;
+  size_t i = 0;
+  size_t n;
 
-    case GPS_PARSE_STATE_UNICORE_BIN_PAYLOAD:
-      gps->unicore_bin.payload_pos++;
+  if (gps->state == GPS_PARSE_STATE_UNICORE_BIN_SYNC_3) {
+    gps->state = GPS_PARSE_STATE_UNICORE_BIN_HEADER;
+  }
 
-      if (gps->unicore_bin.payload_pos >= gps->unicore_bin.header.msg_len) {
-        // 페이로드 완료, CRC 읽기
-        gps->state = GPS_PARSE_STATE_UNICORE_BIN_CRC;
-        gps->unicore_bin.crc_pos = 0;
-      }
-      break;
-
-    case GPS_PARSE_STATE_UNICORE_BIN_CRC:
-      gps->unicore_bin.crc_bytes[gps->unicore_bin.crc_pos++] = (uint8_t)ch;
-
-      if (gps->unicore_bin.crc_pos >= 4) {
-        // CRC 완료, 검증
-        uint32_t received_crc =
-          (uint32_t)gps->unicore_bin.crc_bytes[0] |
-          ((uint32_t)gps->unicore_bin.crc_bytes[1] << 8) |
-          ((uint32_t)gps->unicore_bin.crc_bytes[2] << 16) |
-          ((uint32_t)gps->unicore_bin.crc_bytes[3] << 24);
-
-        // CRC 계산 (sync 3바이트 + 헤더 + 페이로드)
-        size_t total_len = 3 + GPS_UNICORE_BIN_HEADER_SIZE + gps->unicore_bin.header.msg_len;
-        uint32_t calculated_crc = calculate_crc32((uint8_t*)gps->payload, total_len);
-
-        if (received_crc == calculated_crc) {
-          // 파싱 성공
-          LOG_DEBUG("Unicore BIN: ID=%d, Len=%d",
-                    gps->unicore_bin.header.msg_id,
-                    gps->unicore_bin.header.msg_len);
-
-          // 이벤트 발생 (나중에 메시지별 처리 추가)
-          if (gps->handler) {
-            gps_msg_t msg = {0};
-            gps->handler(gps, GPS_EVENT_DATA_PARSED, GPS_PROTOCOL_UNICORE, msg);
-          }
-        }
+  if (gps->state == GPS_PARSE_STATE_UNICORE_BIN_HEADER) {
+    n = GPS_UNICORE_BIN_HEADER_SIZE - gps->pos;
+    if (n > len) {
+      n = len;
+    }
 
-        // 파싱 완료
-        gps->protocol = GPS_PROTOCOL_NONE;
-        gps->state = GPS_PARSE_STATE_NONE;
-        gps->pos = 0;
-      }
-      break;
+    memcpy(&gps->payload[gps->pos], data, n);
+    gps->pos += n;
+    i += n;
+
+    if (gps->pos < GPS_UNICORE_BIN_HEADER_SIZE) {
+      return i;
+    }
+
+    decode_unicore_bin_header(&bin->header, (const uint8_t *)gps->payload);
+
+    /* 이 길이를 넘으면 잘못 잡은 sync로 보고 바로 다시 찾는다 */
+    if (bin->header.msg_len > GPS_UNICORE_BIN_MAX_MSG_LEN) {
+      unicore_bin_done(gps);
+      return i;
+    }
+
+    bin->crc = gps_unicore_crc32_update(0, (const uint8_t *)gps->payload,
+                                        GPS_UNICORE_BIN_HEADER_SIZE);
+    bin->remain = bin->header.msg_len;
+    bin->skip = bin->header.msg_len > GPS_UNICORE_BIN_MAX_PAYLOAD;
+    bin->crc_pos = 0;
 
-    default:
-      break;
+    gps->state = bin->remain > 0 ? GPS_PARSE_STATE_UNICORE_BIN_PAYLOAD
+                                 : GPS_PARSE_STATE_UNICORE_BIN_CRC;
   }
+
+  if (gps->state == GPS_PARSE_STATE_UNICORE_BIN_PAYLOAD) {
+    n = bin->remain;
+    if (n > len - i) {
+      n = len - i;
+    }
+
+    bin->crc = gps_unicore_crc32_update(bin->crc, &data[i], n);
+    if (!bin->skip) {
+      memcpy(&gps->payload[gps->pos], &data[i], n);
+      gps->pos += n;
+    }
+    bin->remain -= n;
+    i += n;
+
+    if (bin->remain > 0) {
+      return i;
+    }
+
+    gps->state = GPS_PARSE_STATE_UNICORE_BIN_CRC;
+  }
+
+  n = GPS_UNICORE_BIN_CRC_SIZE - bin->crc_pos;
+  if (n > len - i) {
+    n = len - i;
+  }
+
+  memcpy(&bin->crc_bytes[bin->crc_pos], &data[i], n);
+  bin->crc_pos += n;
+  i += n;
+
+  if (bin->crc_pos < GPS_UNICORE_BIN_CRC_SIZE) {
+    return i;
+  }
+
+  if (uc_u4(bin->crc_bytes) == bin->crc) {
+    LOG_DEBUG("Unicore BIN: ID=%d, Len=%d", bin->header.msg_id,
+              bin->header.msg_len);
+
+    if (!bin->skip) {
+      decode_unicore_bin(gps);
+    }
+
+    if (gps->handler) {
+      gps_msg_t msg = {0};
+      msg.unicore = bin->header.msg_id;
+      gps->handler(gps, GPS_EVENT_DATA_PARSED, GPS_PROTOCOL_UNICORE, msg);
+    }
+  }
+
+  unicore_bin_done(gps);
+
+  return i;
 }
@@ -4,12 +4,27 @@
 #include "gps_types.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #define GPS_UNICORE_TERM_SIZE 32
-#define GPS_UNICORE_BIN_HEADER_SIZE 28
+#define GPS_UNICORE_BIN_HEADER_SIZE 24  // sync 3바이트 포함
+#define GPS_UNICORE_BIN_CRC_SIZE 4
 #define GPS_UNICORE_BIN_SYNC_1 0xAA
 #define GPS_UNICORE_BIN_SYNC_2 0x44
-#define GPS_UNICORE_BIN_SYNC_3 0x12
+#define GPS_UNICORE_BIN_SYNC_3 0xB5
+
+/* 바이너리 메시지 ID */
+#define GPS_UNICORE_BIN_ID_ADRNAV 142
+#define GPS_UNICORE_BIN_ID_UNIHEADING 972
+#define GPS_UNICORE_BIN_ID_PVTSLN 1021
+#define GPS_UNICORE_BIN_ID_BESTNAV 2118
+
+/* 디코딩하는 메시지의 최대 페이로드 (PVTSLN 위성 목록 포함)
+ * 이보다 긴 메시지는 버퍼에 담지 않고 CRC만 확인하며 건너뛴다 */
+#define GPS_UNICORE_BIN_MAX_PAYLOAD 512
+
+/* 헤더 길이 필드의 상한 (넘으면 잘못 잡은 sync로 보고 버림) */
+#define GPS_UNICORE_BIN_MAX_MSG_LEN 8192
 
 /**
  * @brief Unicore 응답 상태
@@ -31,12 +46,95 @@ typedef enum {
   GPS_UNICORE_MSG_INVALID = UINT8_MAX
 } gps_unicore_msg_t;
 
+/**
+ * @brief Unicore 위치 타입 (BESTNAV/ADRNAV/PVTSLN pos type)
+ */
+typedef enum {
+  GPS_UNICORE_POS_NONE = 0,
+  GPS_UNICORE_POS_FIXEDPOS = 1,
+  GPS_UNICORE_POS_FIXEDHEIGHT = 2,
+  GPS_UNICORE_POS_DOPPLER_VELOCITY = 8,
+  GPS_UNICORE_POS_SINGLE = 16,
+  GPS_UNICORE_POS_PSRDIFF = 17,
+  GPS_UNICORE_POS_SBAS = 18,
+  GPS_UNICORE_POS_PROPAGATED = 19,
+  GPS_UNICORE_POS_L1_FLOAT = 32,
+  GPS_UNICORE_POS_IONOFREE_FLOAT = 33,
+  GPS_UNICORE_POS_NARROW_FLOAT = 34,
+  GPS_UNICORE_POS_L1_INT = 48,
+  GPS_UNICORE_POS_WIDE_INT = 49,
+  GPS_UNICORE_POS_NARROW_INT = 50,
+} gps_unicore_pos_type_t;
+
+/**
+ * @brief BESTNAV/ADRNAV 위치 (두 메시지의 위치 부분은 배치가 같음)
+ */
+typedef struct {
+  uint32_t week;
+  uint32_t tow_ms;         // GPS 주 중 시각 [ms]
+  uint32_t sol_status;     // 0: SOL_COMPUTED
+  uint32_t pos_type;       // gps_unicore_pos_type_t
+  double lat;              // [deg]
+  double lon;              // [deg]
+  double hgt;              // 해발고 [m]
+  float undulation;        // 지오이드고 [m]
+  float lat_std;           // [m]
+  float lon_std;           // [m]
+  float hgt_std;           // [m]
+  float diff_age;          // 보정 수신 후 경과 [s]
+  uint8_t svs;             // 추적 위성 수
+  uint8_t soln_svs;        // 해에 사용한 위성 수
+} gps_unicore_bestnav_t;
+
+/**
+ * @brief PVTSLN (위치/속도/헤딩/DOP 요약)
+ */
+typedef struct {
+  uint32_t tow_ms;
+  uint32_t pos_type;       // bestpos_type
+  double lat;              // [deg]
+  double lon;              // [deg]
+  float hgt;               // 해발고 [m]
+  float undulation;        // [m]
+  float lat_std;
+  float lon_std;
+  float hgt_std;
+  float diff_age;
+  uint8_t soln_svs;
+  uint32_t heading_type;
+  float heading_length;    // 기선 길이 [m]
+  float heading;           // [deg]
+  float pitch;             // [deg]
+  float hdop;
+  float pdop;
+} gps_unicore_pvtsln_t;
+
+/**
+ * @brief UNIHEADING (듀얼 안테나 헤딩)
+ */
+typedef struct {
+  uint32_t tow_ms;
+  uint32_t sol_status;
+  uint32_t pos_type;
+  float length;            // 기선 길이 [m]
+  float heading;           // [deg]
+  float pitch;             // [deg]
+  float heading_std;       // [deg]
+  float pitch_std;         // [deg]
+  uint8_t soln_svs;
+} gps_unicore_heading_t;
+
 /**
  * @brief Unicore 파싱 데이터
  */
 typedef struct {
   gps_unicore_response_t last_response;
   char response_str[GPS_UNICORE_TERM_SIZE];
+
+  gps_unicore_bestnav_t bestnav;
+  gps_unicore_bestnav_t adrnav;
+  gps_unicore_pvtsln_t pvtsln;
+  gps_unicore_heading_t heading;
 } gps_unicore_data_t;
 
 /**
@@ -53,22 +151,19 @@ typedef struct {
 } gps_unicore_parser_t;
 
 /**
- * @brief Unicore 바이너리 헤더
+ * @brief Unicore 바이너리 헤더 (AA 44 B5, 24바이트)
  */
 typedef struct {
-  uint8_t header_len;      // Header length (28)
+  uint8_t cpu_idle;        // CPU idle [%]
   uint16_t msg_id;         // Message ID
-  uint8_t msg_type;        // Message type
-  uint8_t port_addr;       // Port address
   uint16_t msg_len;        // Message length (payload)
-  uint16_t sequence;       // Sequence number
-  uint8_t idle_time;       // Idle time
+  uint8_t time_ref;        // 0: GPST, 1: BDST
   uint8_t time_status;     // Time status
-  uint16_t week;           // GPS week
-  uint32_t milliseconds;   // GPS milliseconds
-  uint32_t rcv_status;     // Receiver status
-  uint16_t reserved;       // Reserved
-  uint16_t sw_version;     // SW version
+  uint16_t week;           // 주 번호
+  uint32_t tow_ms;         // 주 중 시각 [ms]
+  uint8_t version;         // Release version
+  uint8_t leap_sec;        // 윤초
+  uint16_t output_delay;   // 출력 지연 [ms]
 } gps_unicore_bin_header_t;
 
 /**
@@ -76,16 +171,17 @@ typedef struct {
  */
 typedef struct {
   gps_unicore_bin_header_t header;
-  uint16_t payload_pos;    // 현재 페이로드 읽은 위치
-  uint8_t header_pos;      // 헤더 읽은 위치
-  uint32_t crc;            // CRC 누적
-  uint8_t crc_bytes[4];    // CRC 바이트 (4바이트)
+  uint32_t crc;            // sync부터 누적한 CRC32 (CRC 바이트 제외)
+  uint16_t remain;         // 남은 페이로드 바이트
+  uint8_t crc_bytes[4];    // 수신한 CRC (리틀 엔디언)
   uint8_t crc_pos;         // CRC 읽은 위치
+  bool skip;               // 버퍼에 담지 않고 건너뛰는 중 (디코딩 안 하는 긴 메시지)
 } gps_unicore_bin_parser_t;
 
 typedef struct gps_s gps_t;
 
 uint8_t gps_parse_unicore_term(gps_t *gps);
-void gps_parse_unicore_bin(gps_t *gps);
+size_t gps_parse_unicore_bin(gps_t *gps, const uint8_t *data, size_t len);
+uint32_t gps_unicore_crc32_update(uint32_t crc, const uint8_t *data, size_t len);
 
 #endif
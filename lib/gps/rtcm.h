@@ -10,12 +10,27 @@
 #endif
 
 #include "log.h"
+#include "gps_config.h"
 
 // RTCM3 프로토콜 정의
 #define RTCM3_PREAMBLE 0xD3
 #define RTCM3_MIN_PACKET_SIZE 6  // 헤더(3) + CRC(3)
 #define RTCM3_MAX_PACKET_SIZE 1023 + 6  // 최대 메시지 길이 + 헤더 + CRC
 
+// CRC24Q 테이블 방식 (1: 바이트 테이블, 4: slicing-by-4, 8: slicing-by-8)
+#ifndef RTCM_CRC24_SLICE_BY
+    #define RTCM_CRC24_SLICE_BY 1
+#endif
+
+#if RTCM_CRC24_SLICE_BY != 1 && RTCM_CRC24_SLICE_BY != 4 && RTCM_CRC24_SLICE_BY != 8
+    #error "RTCM_CRC24_SLICE_BY must be 1, 4 or 8"
+#endif
+
+// RTCM 프레임 풀 크기 (GPS 파서 수 + 소비자(LoRa/NTRIP) 큐에 잡혀있는 프레임 수)
+#ifndef RTCM_FRAME_POOL_SIZE
+    #define RTCM_FRAME_POOL_SIZE 8
+#endif
+
 // RTCM 패킷 파싱 상태
 typedef enum {
     RTCM_PARSE_STATE_IDLE = 0,
@@ -26,12 +41,99 @@ typedef enum {
     RTCM_PARSE_STATE_COMPLETE
 } rtcm_parse_state_t;
 
+// RTCM 프레임 (프레임 풀에서 할당, 참조 카운트로 소비자 간 공유)
+typedef struct {
+    uint8_t data[RTCM3_MAX_PACKET_SIZE];
+    uint16_t length;          // 프레임 전체 길이 (헤더 + 페이로드 + CRC)
+    uint16_t message_type;    // RTCM 메시지 타입
+    volatile uint8_t ref;     // 참조 카운트 (0: 미사용)
+} rtcm_frame_t;
+
+// RTCM 프레임 풀 통계
+typedef struct {
+    uint8_t in_use;           // 현재 사용 중인 프레임 수
+    uint8_t peak;             // 최대 사용 프레임 수
+    uint32_t alloc_failed;    // 할당 실패 횟수
+} rtcm_frame_pool_stats_t;
+
+// RTCM 위성 시스템 (MSM 메시지 타입 범위로 구분)
+typedef enum {
+    RTCM_GNSS_NONE = 0,
+    RTCM_GNSS_GPS,       // 1071~1077
+    RTCM_GNSS_GLONASS,   // 1081~1087
+    RTCM_GNSS_GALILEO,   // 1091~1097
+    RTCM_GNSS_SBAS,      // 1101~1107
+    RTCM_GNSS_QZSS,      // 1111~1117
+    RTCM_GNSS_BEIDOU,    // 1121~1127
+    RTCM_GNSS_NAVIC,     // 1131~1137
+    RTCM_GNSS_MAX
+} rtcm_gnss_t;
+
+// MSM 헤더 비트 위치 (페이로드 기준, DF002 메시지 타입부터)
+#define RTCM_MSM_SAT_MASK_POS   73
+#define RTCM_MSM_SIG_MASK_POS   137
+#define RTCM_MSM_CELL_MASK_POS  169
+#define RTCM_MSM_MAX_CELLS      64
+
+// MSM 공통 헤더
+typedef struct {
+    uint16_t message_type;
+    uint16_t station_id;      // DF003
+    uint32_t epoch;           // GNSS epoch time (ms, GLONASS는 DOW 3비트 + ms 27비트)
+    bool multi_msg;           // DF393 같은 epoch의 MSM이 더 있음
+    uint8_t iods;             // DF409
+    uint8_t clk_steering;     // DF411
+    uint8_t ext_clk;          // DF412
+    bool smoothing;           // DF417
+    uint8_t smoothing_int;    // DF418
+    uint64_t sat_mask;        // DF394 (MSB: 위성 ID 1)
+    uint32_t sig_mask;        // DF395 (MSB: 신호 ID 1)
+    uint64_t cell_mask;       // DF396 (nsat * nsig 비트, 하위 정렬)
+    uint8_t nsat;
+    uint8_t nsig;
+    uint8_t ncell;
+    uint16_t hdr_bits;        // 셀 마스크까지 포함한 헤더 비트 수
+} rtcm_msm_header_t;
+
+// 1005/1006 기준국 좌표
+typedef struct {
+    uint16_t station_id;      // DF003
+    uint8_t itrf_year;        // DF021
+    bool gps;                 // DF022
+    bool glonass;             // DF023
+    bool galileo;             // DF024
+    bool ref_station;         // DF141 (0: 실제 기준국, 1: 가상 기준국)
+    bool single_osc;          // DF142
+    uint8_t quarter_cycle;    // DF364
+    int64_t ecef[3];          // ARP ECEF X/Y/Z (0.1 mm)
+    uint16_t ant_height;      // DF028 (0.1 mm, 1006만)
+    bool has_height;
+} rtcm_station_t;
+
+// 1033 수신기/안테나 기술자 (프레임 버퍼를 직접 가리킴, NULL 종료 아님)
+typedef struct {
+    uint16_t station_id;
+    const char *ant_desc;     // DF030
+    uint8_t ant_desc_len;
+    uint8_t ant_setup_id;     // DF031
+    const char *ant_serial;   // DF033
+    uint8_t ant_serial_len;
+    const char *rx_type;      // DF228
+    uint8_t rx_type_len;
+    const char *rx_fw;        // DF230
+    uint8_t rx_fw_len;
+    const char *rx_serial;    // DF232
+    uint8_t rx_serial_len;
+} rtcm_rx_desc_t;
+
 // RTCM 패킷 구조체
 typedef struct {
-    uint8_t buffer[RTCM3_MAX_PACKET_SIZE];
+    rtcm_frame_t *frame;      // 수신 중인 프레임 (프레임 풀)
+    uint8_t *buffer;          // frame->data
     uint16_t length;          // 페이로드 길이
     uint16_t bytes_received;  // 현재까지 받은 바이트 수
     uint16_t message_type;    // RTCM 메시지 타입
+    uint32_t crc;             // 수신 중 누적 CRC24 (CRC 바이트 제외)
     rtcm_parse_state_t state;
 } rtcm_packet_t;
 
@@ -85,6 +187,15 @@ uint16_t rtcm_get_total_length(uint16_t payload_length);
  */
 uint32_t rtcm_crc24(const uint8_t *data, size_t len);
 
+/**
+ * @brief CRC24 누적 계산
+ * @param crc 이전 CRC24 값 (처음은 0)
+ * @param data 데이터 버퍼
+ * @param len 데이터 길이
+ * @return 갱신된 CRC24 값
+ */
+uint32_t rtcm_crc24_update(uint32_t crc, const uint8_t *data, size_t len);
+
 /**
  * @brief RTCM 패킷 CRC 검증
  * @param data 완전한 RTCM 패킷
@@ -101,6 +212,16 @@ bool rtcm_verify_crc(const uint8_t *data, size_t len);
  */
 bool rtcm_parse_byte(rtcm_parser_t *parser, uint8_t byte);
 
+/**
+ * @brief 블록 단위 RTCM 파싱 (DMA 청크 처리용)
+ * @param parser 파서 구조체
+ * @param data 입력 버퍼
+ * @param len 입력 길이
+ * @param consumed 처리한 바이트 수
+ * @return true: 패킷 완성, false: 계속 수신 필요 또는 오류(파서 IDLE)
+ */
+bool rtcm_parse_block(rtcm_parser_t *parser, const uint8_t *data, size_t len, size_t *consumed);
+
 /**
  * @brief 완성된 RTCM 패킷 가져오기
  * @param parser 파서 구조체
@@ -109,10 +230,186 @@ bool rtcm_parse_byte(rtcm_parser_t *parser, uint8_t byte);
  */
 void rtcm_get_packet(rtcm_parser_t *parser, const uint8_t **out_data, uint16_t *out_len);
 
+/**
+ * @brief 완성된 RTCM 프레임 가져오기 (복사 없이 공유)
+ *
+ * 이벤트 핸들러 밖에서 계속 사용하려면 rtcm_frame_ref()로 참조를 잡고,
+ * 사용이 끝나면 rtcm_frame_unref()를 호출해야 한다.
+ *
+ * @param parser 파서 구조체
+ * @return 완성된 프레임, 없으면 NULL
+ */
+rtcm_frame_t *rtcm_get_frame(rtcm_parser_t *parser);
+
+/**
+ * @brief 프레임 풀에서 프레임 할당 (참조 카운트 1)
+ * @return 프레임 포인터, 풀이 비었으면 NULL
+ */
+rtcm_frame_t *rtcm_frame_alloc(void);
+
+/**
+ * @brief 프레임 참조 추가
+ * @param frame 프레임 포인터
+ */
+void rtcm_frame_ref(rtcm_frame_t *frame);
+
+/**
+ * @brief 프레임 참조 해제 (0이 되면 풀로 반환)
+ * @param frame 프레임 포인터
+ */
+void rtcm_frame_unref(rtcm_frame_t *frame);
+
+/**
+ * @brief 프레임 풀 통계
+ * @return 통계 구조체 포인터
+ */
+const rtcm_frame_pool_stats_t *rtcm_frame_pool_get_stats(void);
+
 /**
  * @brief 파서 리셋
  * @param parser 파서 구조체
  */
 void rtcm_parser_reset(rtcm_parser_t *parser);
 
+/*
+ * 지연(lazy) 헤더 디코더
+ *
+ * 아래 함수들은 완성된 RTCM 패킷(프리앰블부터, data[0] == 0xD3)을 받아
+ * 필요한 필드만 프레임 버퍼에서 바로 읽는다. 관측값 본문은 디코딩하지 않는다.
+ * 비트 위치는 페이로드(data + 3) 첫 비트 기준이다.
+ */
+
+/**
+ * @brief 페이로드에서 부호 없는 비트 필드 읽기 (MSB 우선)
+ * @param data RTCM 패킷
+ * @param pos 페이로드 기준 비트 위치
+ * @param len 비트 수 (1~32)
+ * @return 필드 값
+ */
+uint32_t rtcm_get_bits(const uint8_t *data, uint32_t pos, uint8_t len);
+
+/**
+ * @brief 페이로드에서 부호 있는 비트 필드 읽기 (2의 보수)
+ * @param data RTCM 패킷
+ * @param pos 페이로드 기준 비트 위치
+ * @param len 비트 수 (1~32)
+ * @return 필드 값
+ */
+int32_t rtcm_get_sbits(const uint8_t *data, uint32_t pos, uint8_t len);
+
+/**
+ * @brief 페이로드에서 부호 없는 비트 필드 읽기 (최대 64비트)
+ * @param data RTCM 패킷
+ * @param pos 페이로드 기준 비트 위치
+ * @param len 비트 수 (1~64)
+ * @return 필드 값
+ */
+uint64_t rtcm_get_bits64(const uint8_t *data, uint32_t pos, uint8_t len);
+
+/**
+ * @brief 페이로드에서 부호 있는 비트 필드 읽기 (최대 64비트)
+ * @param data RTCM 패킷
+ * @param pos 페이로드 기준 비트 위치
+ * @param len 비트 수 (1~64)
+ * @return 필드 값
+ */
+int64_t rtcm_get_sbits64(const uint8_t *data, uint32_t pos, uint8_t len);
+
+/**
+ * @brief MSM 메시지 타입 여부
+ * @param msg_type 메시지 타입
+ * @return true: MSM1~7
+ */
+bool rtcm_is_msm(uint16_t msg_type);
+
+/**
+ * @brief MSM 번호 (1~7)
+ * @param msg_type 메시지 타입
+ * @return MSM 번호, MSM이 아니면 0
+ */
+uint8_t rtcm_msm_level(uint16_t msg_type);
+
+/**
+ * @brief 메시지 타입의 위성 시스템
+ *
+ * MSM 외에 1019(GPS)/1020(GLONASS)/1042(BeiDou)/1044(QZSS)/1045,1046(Galileo)
+ * 궤도력과 1230(GLONASS 코드-위상 바이어스)도 구분한다.
+ *
+ * @param msg_type 메시지 타입
+ * @return 위성 시스템, 시스템과 무관한 메시지면 RTCM_GNSS_NONE
+ */
+rtcm_gnss_t rtcm_msg_gnss(uint16_t msg_type);
+
+/**
+ * @brief MSM 기준국 ID (DF003)
+ * @param data RTCM 패킷
+ * @return 기준국 ID
+ */
+uint16_t rtcm_msm_station_id(const uint8_t *data);
+
+/**
+ * @brief MSM epoch 시간 (DF004/DF034/DF248/DF427 등, 30비트)
+ * @param data RTCM 패킷
+ * @return epoch 시간 (ms, GLONASS는 상위 3비트가 요일)
+ */
+uint32_t rtcm_msm_epoch(const uint8_t *data);
+
+/**
+ * @brief MSM multiple message 비트 (DF393)
+ * @param data RTCM 패킷
+ * @return true: 같은 epoch의 MSM이 뒤따름
+ */
+bool rtcm_msm_multi_msg(const uint8_t *data);
+
+/**
+ * @brief MSM 위성 마스크 (DF394)
+ * @param data RTCM 패킷
+ * @return 64비트 위성 마스크 (MSB: 위성 ID 1)
+ */
+uint64_t rtcm_msm_sat_mask(const uint8_t *data);
+
+/**
+ * @brief MSM 신호 마스크 (DF395)
+ * @param data RTCM 패킷
+ * @return 32비트 신호 마스크 (MSB: 신호 ID 1)
+ */
+uint32_t rtcm_msm_sig_mask(const uint8_t *data);
+
+/**
+ * @brief MSM 셀 개수 (셀 마스크 DF396의 1 비트 수)
+ * @param data RTCM 패킷
+ * @return 셀 개수, 헤더가 잘못되었으면 0
+ */
+uint8_t rtcm_msm_cell_count(const uint8_t *data);
+
+/**
+ * @brief MSM 공통 헤더 전체 디코딩
+ * @param data RTCM 패킷
+ * @param len 패킷 길이
+ * @param hdr 출력 헤더
+ * @return true: 성공, false: MSM 아님 또는 길이 부족
+ */
+bool rtcm_decode_msm_header(const uint8_t *data, size_t len, rtcm_msm_header_t *hdr);
+
+/**
+ * @brief 1005/1006 기준국 좌표 디코딩
+ * @param data RTCM 패킷
+ * @param len 패킷 길이
+ * @param sta 출력 기준국 정보
+ * @return true: 성공, false: 1005/1006 아님 또는 길이 부족
+ */
+bool rtcm_decode_station(const uint8_t *data, size_t len, rtcm_station_t *sta);
+
+/**
+ * @brief 1033 수신기/안테나 기술자 디코딩
+ *
+ * 문자열 필드는 프레임 버퍼를 그대로 가리키므로 프레임을 잡고 있는 동안만 유효하다.
+ *
+ * @param data RTCM 패킷
+ * @param len 패킷 길이
+ * @param desc 출력 기술자
+ * @return true: 성공, false: 1033 아님 또는 길이 부족
+ */
+bool rtcm_decode_rx_desc(const uint8_t *data, size_t len, rtcm_rx_desc_t *desc);
+
 #endif
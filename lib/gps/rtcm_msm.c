@@ -0,0 +1,188 @@
+#include "rtcm_msm.h"
+#include <string.h>
+
+/**
+ * @brief 페이로드에 비트 필드 쓰기 (MSB 우선, 대상 비트는 0으로 비워져 있어야 함)
+ */
+static void rtcm_msm_put_bits(uint8_t *data, uint32_t pos, uint8_t len, uint32_t val) {
+    uint8_t *p = data + 3;
+
+    while (len) {
+        uint32_t shift = pos & 7;
+        uint32_t n = 8 - shift;
+        if (n > len) {
+            n = len;
+        }
+
+        uint32_t bits = (val >> (len - n)) & ((1u << n) - 1);
+        p[pos >> 3] |= (uint8_t)(bits << (8 - shift - n));
+
+        pos += n;
+        len -= n;
+    }
+}
+
+/**
+ * @brief 정밀 거리/위상을 낮은 분해능으로 반올림 (floor(x + 0.5))
+ *
+ * @param v 입력 값 (무효 값 -2^(in_bits-1) 포함)
+ * @param in_bits 입력 비트 수
+ * @param shift 분해능 차이 (비트)
+ * @param out_bits 출력 비트 수
+ * @return 출력 값, 무효이거나 범위를 벗어나면 -2^(out_bits-1)
+ */
+static int32_t rtcm_msm_round_fine(int32_t v, uint8_t in_bits, uint8_t shift, uint8_t out_bits) {
+    int32_t invalid_out = -(1L << (out_bits - 1));
+    int32_t r;
+
+    if (v == -(1L << (in_bits - 1))) {
+        return invalid_out;
+    }
+
+    // 음수 오른쪽 시프트는 산술 시프트 (GCC)
+    r = (v + (1L << (shift - 1))) >> shift;
+    if (r <= invalid_out || r >= (1L << (out_bits - 1))) {
+        return invalid_out;
+    }
+
+    return r;
+}
+
+/**
+ * @brief DF407 (확장 잠금 시간 지시자) -> DF402 (잠금 시간 지시자)
+ *
+ * DF407이 나타내는 최소 잠금 시간 t [ms]를 구해 2^(i+4) <= t 인 최대 i로 바꾼다.
+ */
+static uint8_t rtcm_msm_lock_ex_to_lock(uint32_t ex) {
+    uint32_t t;
+    uint8_t ind;
+
+    if (ex < 64) {
+        t = ex;
+    } else if (ex < 704) {
+        uint32_t n = ex / 32 - 1;
+        t = (ex << n) - ((32 * n) << n);
+    } else {
+        t = 67108864UL;
+    }
+
+    if (t < 32) {
+        return 0;
+    }
+
+    ind = (uint8_t)(31 - __builtin_clz(t) - 4);
+    return ind > 15 ? 15 : ind;
+}
+
+/**
+ * @brief MSM7 프레임을 MSM4 프레임으로 변환
+ */
+uint16_t rtcm_msm7_to_msm4(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_size) {
+    rtcm_msm_header_t hdr;
+    uint32_t hdr_bits, nsat, ncell;
+    uint32_t s7, c7, s4, c4, out_bits;
+    uint16_t out_len, plen;
+    uint32_t crc;
+
+    if (!in || !out) return 0;
+    if (!rtcm_decode_msm_header(in, in_len, &hdr)) return 0;
+    if (rtcm_msm_level(hdr.message_type) != 7) return 0;
+
+    hdr_bits = hdr.hdr_bits;
+    nsat = hdr.nsat;
+    ncell = hdr.ncell;
+
+    if ((uint32_t)rtcm_get_payload_length(in) * 8 <
+        hdr_bits + nsat * RTCM_MSM7_SAT_BITS + ncell * RTCM_MSM7_CELL_BITS) {
+        return 0;
+    }
+
+    out_bits = hdr_bits + nsat * RTCM_MSM4_SAT_BITS + ncell * RTCM_MSM4_CELL_BITS;
+    plen = (uint16_t)((out_bits + 7) / 8);
+    out_len = rtcm_get_total_length(plen);
+    if (out_size < out_len) return 0;
+
+    memset(out, 0, out_len);
+    out[0] = RTCM3_PREAMBLE;
+    out[1] = (uint8_t)(plen >> 8);
+    out[2] = (uint8_t)plen;
+
+    // 헤더는 메시지 타입만 다르고 비트 배치가 같다
+    memcpy(out + 3, in + 3, (hdr_bits + 7) / 8);
+    if (hdr_bits & 7) {
+        out[3 + hdr_bits / 8] &= (uint8_t)(0xFF << (8 - (hdr_bits & 7)));
+    }
+    out[3] = (uint8_t)((hdr.message_type - 3) >> 4);
+    out[4] = (uint8_t)((((hdr.message_type - 3) & 0x0F) << 4) | (out[4] & 0x0F));
+
+    // 위성 데이터: DF397, DF398 (필드별로 모든 위성이 이어짐)
+    s7 = hdr_bits;
+    s4 = hdr_bits;
+    for (uint32_t i = 0; i < nsat; i++) {
+        rtcm_msm_put_bits(out, s4 + i * 8, 8, rtcm_get_bits(in, s7 + i * 8, 8));
+        rtcm_msm_put_bits(out, s4 + nsat * 8 + i * 10, 10,
+                          rtcm_get_bits(in, s7 + nsat * 12 + i * 10, 10));
+    }
+
+    // 신호 데이터
+    c7 = s7 + nsat * RTCM_MSM7_SAT_BITS;
+    c4 = s4 + nsat * RTCM_MSM4_SAT_BITS;
+    for (uint32_t k = 0; k < ncell; k++) {
+        int32_t pr = rtcm_get_sbits(in, c7 + k * 20, 20);
+        int32_t cp = rtcm_get_sbits(in, c7 + ncell * 20 + k * 24, 24);
+        uint32_t lock = rtcm_get_bits(in, c7 + ncell * 44 + k * 10, 10);
+        uint32_t half = rtcm_get_bits(in, c7 + ncell * 54 + k, 1);
+        uint32_t cnr = rtcm_get_bits(in, c7 + ncell * 55 + k * 10, 10);
+
+        // DF405 2^-29 ms -> DF400 2^-24 ms, DF406 2^-31 ms -> DF401 2^-29 ms
+        pr = rtcm_msm_round_fine(pr, 20, 5, 15);
+        cp = rtcm_msm_round_fine(cp, 24, 2, 22);
+
+        // DF408 2^-4 dBHz -> DF403 1 dBHz
+        cnr = (cnr + 8) >> 4;
+        if (cnr > 63) {
+            cnr = 63;
+        }
+
+        rtcm_msm_put_bits(out, c4 + k * 15, 15, (uint32_t)pr & 0x7FFF);
+        rtcm_msm_put_bits(out, c4 + ncell * 15 + k * 22, 22, (uint32_t)cp & 0x3FFFFF);
+        rtcm_msm_put_bits(out, c4 + ncell * 37 + k * 4, 4, rtcm_msm_lock_ex_to_lock(lock));
+        rtcm_msm_put_bits(out, c4 + ncell * 41 + k, 1, half);
+        rtcm_msm_put_bits(out, c4 + ncell * 42 + k * 6, 6, cnr);
+    }
+
+    crc = rtcm_crc24(out, 3 + plen);
+    out[3 + plen] = (uint8_t)(crc >> 16);
+    out[3 + plen + 1] = (uint8_t)(crc >> 8);
+    out[3 + plen + 2] = (uint8_t)crc;
+
+    return out_len;
+}
+
+/**
+ * @brief MSM7 프레임을 풀에서 새 프레임에 MSM4로 변환
+ */
+rtcm_frame_t *rtcm_msm7_to_msm4_frame(const rtcm_frame_t *frame) {
+    rtcm_frame_t *out;
+    uint16_t len;
+
+    if (!frame || rtcm_msm_level(frame->message_type) != 7) {
+        return NULL;
+    }
+
+    out = rtcm_frame_alloc();
+    if (!out) {
+        return NULL;
+    }
+
+    len = rtcm_msm7_to_msm4(frame->data, frame->length, out->data, sizeof(out->data));
+    if (len == 0) {
+        rtcm_frame_unref(out);
+        return NULL;
+    }
+
+    out->length = len;
+    out->message_type = rtcm_get_message_type(out->data);
+
+    return out;
+}
@@ -0,0 +1,41 @@
+#ifndef RTCM_MSM_H
+#define RTCM_MSM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "rtcm.h"
+
+// MSM 위성/셀 데이터 비트 수
+#define RTCM_MSM4_SAT_BITS   18  // DF397(8) + DF398(10)
+#define RTCM_MSM4_CELL_BITS  48  // DF400(15) + DF401(22) + DF402(4) + DF420(1) + DF403(6)
+#define RTCM_MSM7_SAT_BITS   36  // DF397(8) + 확장 위성 정보(4) + DF398(10) + DF399(14)
+#define RTCM_MSM7_CELL_BITS  80  // DF405(20) + DF406(24) + DF407(10) + DF420(1) + DF408(10) + DF404(15)
+
+/**
+ * @brief MSM7 프레임을 같은 위성 시스템의 MSM4 프레임으로 변환
+ *
+ * 헤더와 마스크, 대략 거리(DF397/DF398)는 그대로 두고, 셀별 정밀 거리/위상은
+ * MSM4 분해능으로 반올림한다 (범위를 벗어나면 무효 값). 잠금 시간은 DF407이
+ * 나타내는 최소 잠금 시간에 해당하는 DF402 지시자로, C/N0는 1 dBHz 단위로
+ * 바꾼다. 위상 변화율(DF399/DF404)과 확장 위성 정보는 버린다.
+ * 출력은 입력보다 항상 작으므로 out_size는 in_len이면 충분하다.
+ *
+ * @param in MSM7 RTCM 패킷 (프리앰블부터, CRC 포함)
+ * @param in_len 입력 패킷 길이
+ * @param out 출력 버퍼 (in과 겹치면 안 됨)
+ * @param out_size 출력 버퍼 크기
+ * @return 출력 패킷 길이, 실패 시 0 (MSM7 아님, 길이 부족/불일치)
+ */
+uint16_t rtcm_msm7_to_msm4(const uint8_t *in, size_t in_len, uint8_t *out, size_t out_size);
+
+/**
+ * @brief MSM7 프레임을 풀에서 새 프레임에 MSM4로 변환
+ *
+ * @param frame MSM7 프레임
+ * @return 변환된 프레임 (참조 카운트 1), 변환 불가 또는 풀이 비었으면 NULL
+ */
+rtcm_frame_t *rtcm_msm7_to_msm4_frame(const rtcm_frame_t *frame);
+
+#endif
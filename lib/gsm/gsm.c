@@ -2,13 +2,15 @@
 #include "log.h"
 #include "parser.h" // parser.c 함수 사용
 #include "stm32f4xx_hal.h"
-#include "stm32f4xx_ll_usart.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
 #define IS_ASCII(x) (((x) >= 32 && (x) <= 126) || (x) == '\r' || (x) == '\n')
 
+static bool tcp_deliver_data(gsm_t *gsm, uint8_t cid, const uint8_t *data,
+                             size_t len);
+
 void handle_urc_rdy(gsm_t *gsm, const char *data, size_t len) {
   gsm->status.is_powerd = 1;
 
@@ -303,6 +305,7 @@ void handle_urc_qird(gsm_t *gsm, const char *data, size_t len) {
   gsm->tcp.buffer.read_data_len = 0;
   gsm->tcp.buffer.rx_len = 0;
   gsm->tcp.buffer.current_connect_id = connect_id;
+  gsm->tcp.buffer.is_push = false;
 }
 
 /**
@@ -350,6 +353,7 @@ void handle_urc_qistate(gsm_t *gsm, const char *data, size_t len) {
  * @brief +QIURC URC 핸들러
  * 형식:
  * - +QIURC: "recv",<connectID>  (데이터 수신 알림)
+ * - +QIURC: "recv",<connectID>,<len>\r\n<data>  (direct push 모드)
  * - +QIURC: "closed",<connectID>  (연결 종료 알림)
  */
 void handle_urc_qiurc(gsm_t *gsm, const char *data, size_t len) {
@@ -375,6 +379,32 @@ void handle_urc_qiurc(gsm_t *gsm, const char *data, size_t len) {
     // 데이터 수신 알림
     uint8_t connect_id = parse_uint32(&p);
 
+    if (*p == ',') {
+      // ★ direct push 모드: 다음 <len> 바이트가 바이너리 데이터
+      size_t data_len = parse_uint32(&p);
+
+      if (connect_id < GSM_TCP_MAX_SOCKETS && data_len > 0 &&
+          data_len <= GSM_TCP_RX_BUFFER_SIZE) {
+        gsm->tcp.buffer.expected_data_len = data_len;
+        gsm->tcp.buffer.read_data_len = 0;
+        gsm->tcp.buffer.rx_len = 0;
+        gsm->tcp.buffer.current_connect_id = connect_id;
+        gsm->tcp.buffer.is_push = true;
+        gsm->tcp.buffer.is_reading_data = true; // 마지막에 설정
+
+        if (gsm->evt_handler.handler) {
+          gsm->evt_handler.handler(GSM_EVT_TCP_DATA_RECV, &connect_id);
+        }
+      } else {
+        // 뒤따르는 <len> 바이트를 AT 라인으로 읽지 않도록 그만큼 버림
+        gsm->tcp.buffer.discard_len = data_len;
+        LOG_ERR("+QIURC: \"recv\" push 파라미터 오류 (connect_id=%d, len=%d), "
+                "데이터 버림",
+                connect_id, (int)data_len);
+      }
+      return;
+    }
+
     LOG_DEBUG("+QIURC: \"recv\",%d - 이벤트 큐에 추가", connect_id);
 
     if (connect_id < GSM_TCP_MAX_SOCKETS) {
@@ -704,21 +734,52 @@ void gsm_parse_process(gsm_t *gsm, const void *data, size_t len) {
   static char ch_prev1 = 0;
 
   for (; len > 0; ++d, --len) {
-    // ★ TCP 바이너리 데이터 읽기 모드
+    // 받을 수 없는 push 데이터: 길이만큼 건너뜀
+    if (gsm->tcp.buffer.discard_len > 0) {
+      size_t n = gsm->tcp.buffer.discard_len;
+      if (n > len)
+        n = len;
+
+      gsm->tcp.buffer.discard_len -= n;
+
+      // 마지막 바이트는 for 문의 증감식에서 소비
+      d += n - 1;
+      len -= n - 1;
+      continue;
+    }
+
+    // ★ TCP 바이너리 데이터 읽기 모드 (+QIRD 응답 또는 direct push)
     if (gsm->tcp.buffer.is_reading_data) {
-      // +QIRD 응답 후 바이너리 데이터 읽기
+      size_t remain =
+          gsm->tcp.buffer.expected_data_len - gsm->tcp.buffer.read_data_len;
+      size_t room = GSM_TCP_RX_BUFFER_SIZE - gsm->tcp.buffer.rx_len;
+
       if (gsm->tcp.buffer.read_data_len < gsm->tcp.buffer.expected_data_len &&
-          gsm->tcp.buffer.rx_len < GSM_TCP_RX_BUFFER_SIZE) {
-        gsm->tcp.buffer.rx_buf[gsm->tcp.buffer.rx_len++] = *d;
-        gsm->tcp.buffer.read_data_len++;
+          room > 0) {
+        // 길이를 알고 있으므로 바이트 단위가 아닌 블록 단위로 복사
+        size_t n = remain;
+        if (n > room)
+          n = room;
+        if (n > len)
+          n = len;
+
+        memcpy(&gsm->tcp.buffer.rx_buf[gsm->tcp.buffer.rx_len], d, n);
+        gsm->tcp.buffer.rx_len += n;
+        gsm->tcp.buffer.read_data_len += n;
 
         // 모든 데이터를 읽었으면
         if (gsm->tcp.buffer.read_data_len >=
             gsm->tcp.buffer.expected_data_len) {
-          // 콜백 호출 (current_cmd에서 connect_id 추출)
-          // ★ tcp_mutex와 cmd_mutex 모두 필요 (데드락 방지를 위해 tcp_mutex
-          // 먼저)
-          if (xSemaphoreTake(gsm->tcp.tcp_mutex, portMAX_DELAY) == pdTRUE) {
+          if (gsm->tcp.buffer.is_push) {
+            // ★ direct push: QIRD 없이 바로 소켓으로 전달
+            gsm->tcp.buffer.is_reading_data = false;
+            tcp_deliver_data(gsm, gsm->tcp.buffer.current_connect_id,
+                             gsm->tcp.buffer.rx_buf, gsm->tcp.buffer.rx_len);
+          } else if (xSemaphoreTake(gsm->tcp.tcp_mutex, portMAX_DELAY) ==
+                     pdTRUE) {
+            // 콜백 호출 (current_cmd에서 connect_id 추출)
+            // ★ tcp_mutex와 cmd_mutex 모두 필요 (데드락 방지를 위해
+            // tcp_mutex 먼저)
             if (gsm->cmd_mutex &&
                 xSemaphoreTake(gsm->cmd_mutex, portMAX_DELAY) == pdTRUE) {
               if (gsm->current_cmd && gsm->current_cmd->cmd == GSM_CMD_QIRD) {
@@ -736,6 +797,10 @@ void gsm_parse_process(gsm_t *gsm, const void *data, size_t len) {
             xSemaphoreGive(gsm->tcp.tcp_mutex);
           }
         }
+
+        // 마지막 바이트는 for 문의 증감식에서 소비
+        d += n - 1;
+        len -= n - 1;
         continue;
       } else {
         if (xSemaphoreTake(gsm->tcp.tcp_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
@@ -754,7 +819,12 @@ void gsm_parse_process(gsm_t *gsm, const void *data, size_t len) {
           // ★ pbuf에서 데이터 전송
           if (gsm->current_cmd->tx_pbuf) {
             tcp_pbuf_t *pbuf = gsm->current_cmd->tx_pbuf;
-            gsm->ops->send((const char *)pbuf->payload, pbuf->len);
+            // 파싱 중이므로 전송 완료를 기다리지 않음 (링에 복사됨)
+            if (gsm->ops->send_async) {
+              gsm->ops->send_async((const char *)pbuf->payload, pbuf->len);
+            } else {
+              gsm->ops->send((const char *)pbuf->payload, pbuf->len);
+            }
           }
 
           // 이제 응답 대기 모드로 변경
@@ -934,24 +1004,14 @@ void gsm_send_at_cgdcont(gsm_t *gsm, gsm_at_mode_t at_mode,
   }
 }
 
-int gsm_uart_send(const char *data, size_t len) {
-  for (int i = 0; i < len; i++) {
-    while (!LL_USART_IsActiveFlag_TXE(USART1))
-      ;
-    LL_USART_TransmitData8(USART1, *(data + i));
-  }
-
-  while (!LL_USART_IsActiveFlag_TC(USART1))
-    ;
-
-  return 0;
-}
-
-// gsm_port.c의 리셋 함수 선언
+// gsm_port.c의 리셋/전송 함수 선언 (보드별 포트 또는 호스트 시뮬레이션에서 구현)
 extern int gsm_port_reset(void);
+extern int gsm_uart_send(const char *data, size_t len);
+extern int gsm_uart_send_async(const char *data, size_t len);
 
 static const gsm_hal_ops_t stm32_hal_ops = {.reset = gsm_port_reset,
-                                            .send = gsm_uart_send};
+                                            .send = gsm_uart_send,
+                                            .send_async = gsm_uart_send_async};
 
 void gsm_init(gsm_t *gsm, evt_handler_t handler, void *args) {
   memset(gsm, 0, sizeof(gsm_t));
@@ -979,20 +1039,59 @@ void gsm_init(gsm_t *gsm, evt_handler_t handler, void *args) {
 // TCP pbuf 관리 함수
 //=============================================================================
 
+// pbuf 블록 (헤더 + 데이터)
+typedef struct {
+  tcp_pbuf_t hdr;
+  uint8_t data[GSM_TCP_PBUF_BLOCK_SIZE];
+} tcp_pbuf_block_t;
+
+static tcp_pbuf_block_t pbuf_pool[GSM_TCP_PBUF_POOL_SIZE];
+static tcp_pbuf_t *pbuf_free_list = NULL;
+static tcp_pbuf_pool_stats_t pbuf_stats;
+static gsm_t *pbuf_waiter = NULL; ///< 블록 반환을 기다리는 TCP 태스크
+
+/**
+ * @brief pbuf 풀 초기화 (모든 블록을 free list에 연결)
+ */
+static void tcp_pbuf_pool_init(void) {
+  taskENTER_CRITICAL();
+  pbuf_free_list = NULL;
+  for (int i = GSM_TCP_PBUF_POOL_SIZE - 1; i >= 0; i--) {
+    pbuf_pool[i].hdr.payload = pbuf_pool[i].data;
+    pbuf_pool[i].hdr.next = pbuf_free_list;
+    pbuf_free_list = &pbuf_pool[i].hdr;
+  }
+
+  memset(&pbuf_stats, 0, sizeof(pbuf_stats));
+  pbuf_stats.total = GSM_TCP_PBUF_POOL_SIZE;
+  taskEXIT_CRITICAL();
+}
+
 /**
  * @brief pbuf 할당
  */
 tcp_pbuf_t *tcp_pbuf_alloc(size_t len) {
-  tcp_pbuf_t *pbuf = (tcp_pbuf_t *)pvPortMalloc(sizeof(tcp_pbuf_t));
-  if (!pbuf)
-    return NULL;
+  tcp_pbuf_t *pbuf = NULL;
 
-  pbuf->payload = (uint8_t *)pvPortMalloc(len);
-  if (!pbuf->payload) {
-    vPortFree(pbuf);
-    return NULL;
+  taskENTER_CRITICAL();
+  if (len <= GSM_TCP_PBUF_BLOCK_SIZE && pbuf_free_list) {
+    pbuf = pbuf_free_list;
+    pbuf_free_list = pbuf->next;
+
+    pbuf_stats.in_use++;
+    if (pbuf_stats.in_use > pbuf_stats.high_water) {
+      pbuf_stats.high_water = pbuf_stats.in_use;
+    }
+  } else {
+    pbuf_stats.alloc_failed++;
   }
+  taskEXIT_CRITICAL();
+
+  if (!pbuf)
+    return NULL;
 
+  // 소비 측에서 payload를 전진시킬 수 있으므로 블록 시작으로 복원
+  pbuf->payload = ((tcp_pbuf_block_t *)pbuf)->data;
   pbuf->len = len;
   pbuf->tot_len = len;
   pbuf->next = NULL;
@@ -1004,13 +1103,54 @@ tcp_pbuf_t *tcp_pbuf_alloc(size_t len) {
  * @brief pbuf 해제
  */
 void tcp_pbuf_free(tcp_pbuf_t *pbuf) {
+  gsm_t *waiter;
+
   if (!pbuf)
     return;
 
-  if (pbuf->payload) {
-    vPortFree(pbuf->payload);
+  taskENTER_CRITICAL();
+  pbuf->next = pbuf_free_list;
+  pbuf_free_list = pbuf;
+  pbuf_stats.in_use--;
+  waiter = pbuf_waiter;
+  pbuf_waiter = NULL;
+  taskEXIT_CRITICAL();
+
+  // 블록 부족으로 멈춘 QIRD 루프 재개
+  if (waiter) {
+    tcp_event_t evt = {.type = TCP_EVT_PBUF_FREE,
+                       .connect_id = GSM_TCP_READ_IDLE};
+    xQueueSend(waiter->tcp.event_queue, &evt, 0);
   }
-  vPortFree(pbuf);
+}
+
+/**
+ * @brief 빈 블록이 없으면 반환 알림 등록
+ *
+ * @param gsm 알림 받을 GSM 핸들
+ * @return true: 빈 블록 없음 (반환 시 TCP_EVT_PBUF_FREE), false: 바로 할당 가능
+ */
+static bool tcp_pbuf_wait_free(gsm_t *gsm) {
+  bool empty;
+
+  taskENTER_CRITICAL();
+  empty = (pbuf_free_list == NULL);
+  pbuf_waiter = empty ? gsm : NULL;
+  taskEXIT_CRITICAL();
+
+  return empty;
+}
+
+/**
+ * @brief pbuf 풀 통계 조회
+ */
+void tcp_pbuf_pool_get_stats(tcp_pbuf_pool_stats_t *stats) {
+  if (!stats)
+    return;
+
+  taskENTER_CRITICAL();
+  *stats = pbuf_stats;
+  taskEXIT_CRITICAL();
 }
 
 /**
@@ -1088,44 +1228,141 @@ tcp_pbuf_t *tcp_pbuf_dequeue(gsm_tcp_socket_t *socket) {
 // TCP 태스크
 //=============================================================================
 
+/**
+ * @brief 수신 데이터를 소켓 pbuf 체인에 넣고 on_recv 호출
+ *
+ * QIRD 응답(tcp_read_complete_callback)과 direct push URC에서 공통 사용.
+ *
+ * @return false: pbuf 블록 부족으로 데이터를 버림
+ */
+static bool tcp_deliver_data(gsm_t *gsm, uint8_t cid, const uint8_t *data,
+                             size_t len) {
+  tcp_recv_callback_t on_recv = NULL;
+  bool stored = false;
+
+  if (cid >= GSM_TCP_MAX_SOCKETS || len == 0)
+    return true;
+
+  if (xSemaphoreTake(gsm->tcp.tcp_mutex, portMAX_DELAY) == pdTRUE) {
+    gsm_tcp_socket_t *socket = &gsm->tcp.sockets[cid];
+
+    // pbuf 할당 및 데이터 복사
+    tcp_pbuf_t *pbuf = tcp_pbuf_alloc(len);
+    if (pbuf) {
+      memcpy(pbuf->payload, data, len);
+
+      // ★ gsm_tcp_socket_t의 pbuf 링크리스트에 추가 (lwcell 방식)
+      // 실시간 스트리밍: 메모리 부족 시 오래된 데이터 자동 버림
+      tcp_pbuf_enqueue(socket, pbuf);
+
+      // 사용자 콜백 호출 (뮤텍스 밖에서)
+      on_recv = socket->on_recv;
+      stored = true;
+    }
+    xSemaphoreGive(gsm->tcp.tcp_mutex);
+  }
+
+  if (!stored) {
+    taskENTER_CRITICAL();
+    pbuf_stats.rx_dropped += len;
+    taskEXIT_CRITICAL();
+
+    LOG_WARN("pbuf 부족, 수신 데이터 %u 바이트 버림 (connect_id=%d)",
+             (unsigned)len, cid);
+  }
+
+  if (on_recv) {
+    // 데이터 도착 알림 (콜백에서 tcp_pbuf_dequeue 호출)
+    on_recv(cid);
+  }
+
+  return stored;
+}
+
 /**
  * @brief TCP 읽기 완료 콜백 (비동기)
+ *
+ * 데이터를 소켓으로 넘긴 뒤 TCP 태스크에 결과를 알린다.
+ * 읽은 데이터가 있으면 모뎀에 남은 데이터가 있을 수 있으므로 READ_MORE,
+ * 0 바이트거나 에러/타임아웃이면 READ_DONE으로 파이프라인을 종료한다.
+ * pbuf 블록이 없어 데이터를 버렸으면 read_nomem을 세우고 READ_DONE을 보내
+ * 블록이 반환될 때까지 읽기를 멈춘다 (소켓 대기 비트는 유지).
  */
 static void tcp_read_complete_callback(gsm_t *gsm, gsm_cmd_t cmd, void *msg,
                                        bool is_ok) {
-  if (!is_ok || !msg || cmd != GSM_CMD_QIRD)
+  if (cmd != GSM_CMD_QIRD)
     return;
 
-  gsm_msg_t *m = (gsm_msg_t *)msg;
+  tcp_event_t evt = {.type = TCP_EVT_READ_DONE,
+                     .connect_id = GSM_TCP_READ_IDLE};
 
-  if (xSemaphoreTake(gsm->tcp.tcp_mutex, portMAX_DELAY) == pdTRUE) {
-    uint8_t cid = m->qird.connect_id;
+  if (is_ok && msg) {
+    gsm_msg_t *m = (gsm_msg_t *)msg;
+    evt.connect_id = m->qird.connect_id;
 
-    if (cid < GSM_TCP_MAX_SOCKETS && m->qird.read_actual_length > 0) {
-      gsm_tcp_socket_t *socket = &gsm->tcp.sockets[cid];
+    if (m->qird.connect_id < GSM_TCP_MAX_SOCKETS &&
+        m->qird.read_actual_length > 0) {
+      if (tcp_deliver_data(gsm, m->qird.connect_id, m->qird.data,
+                           m->qird.read_actual_length)) {
+        evt.type = TCP_EVT_READ_MORE;
+      } else {
+        gsm->tcp.read_nomem = true;
+      }
+    }
+  }
+
+  // ★ 다음 QIRD 발행은 TCP 태스크에서 (파서 컨텍스트에서 큐잉하지 않음)
+  if (xQueueSend(gsm->tcp.event_queue, &evt, pdMS_TO_TICKS(10)) != pdTRUE) {
+    LOG_ERR("QIRD 완료 이벤트 큐 오버플로우! (connect_id=%d)", evt.connect_id);
+  }
+}
 
-      // pbuf 할당 및 데이터 복사
-      tcp_pbuf_t *pbuf = tcp_pbuf_alloc(m->qird.read_actual_length);
-      if (pbuf) {
-        memcpy(pbuf->payload, m->qird.data, m->qird.read_actual_length);
+/**
+ * @brief 대기 중인 소켓에 대해 다음 QIRD 발행
+ *
+ * 한 번에 하나의 QIRD만 진행하며, 완료 이벤트를 받으면 다시 호출된다.
+ * gsm_tcp_task 컨텍스트에서만 호출.
+ */
+static void tcp_read_kick(gsm_t *gsm) {
+  if (gsm->tcp.read_cid != GSM_TCP_READ_IDLE) {
+    // 완료 이벤트 유실 대비: QIRD 타임아웃을 넘기면 진행 중 상태 해제
+    uint32_t timeout_ms = gsm->at_tbl[GSM_CMD_QIRD].timeout_ms + 1000;
+    if ((xTaskGetTickCount() - gsm->tcp.read_start) < pdMS_TO_TICKS(timeout_ms)) {
+      return;
+    }
+
+    LOG_WARN("QIRD 완료 이벤트 유실 (connect_id=%d), 읽기 재시작",
+             gsm->tcp.read_cid);
+    gsm->tcp.read_pending |= (uint16_t)(1U << gsm->tcp.read_cid);
+    gsm->tcp.read_cid = GSM_TCP_READ_IDLE;
+  }
 
-        // ★ gsm_tcp_socket_t의 pbuf 링크리스트에 추가 (lwcell 방식)
-        // 실시간 스트리밍: 메모리 부족 시 오래된 데이터 자동 버림
-        tcp_pbuf_enqueue(socket, pbuf);
+  // 빈 블록이 없으면 모뎀 버퍼에 남겨두고 블록 반환(TCP_EVT_PBUF_FREE)까지 대기
+  if (gsm->tcp.read_pending && tcp_pbuf_wait_free(gsm)) {
+    return;
+  }
 
-        // 사용자 콜백 호출 (뮤텍스 밖에서)
-        tcp_recv_callback_t on_recv = socket->on_recv;
+  for (uint8_t cid = 0; cid < GSM_TCP_MAX_SOCKETS; cid++) {
+    uint16_t bit = (uint16_t)(1U << cid);
+    if (!(gsm->tcp.read_pending & bit)) {
+      continue;
+    }
 
-        xSemaphoreGive(gsm->tcp.tcp_mutex);
+    gsm->tcp.read_pending &= (uint16_t)~bit;
 
-        if (on_recv) {
-          // 데이터 도착 알림 (콜백에서 tcp_pbuf_dequeue 호출)
-          on_recv(cid);
-        }
-        return;
-      }
+    // 콜백보다 먼저 상태 기록 (응답이 매우 빨리 올 수 있음)
+    gsm->tcp.read_cid = cid;
+    gsm->tcp.read_start = xTaskGetTickCount();
+
+    // ✅ 여기서는 동기 호출 불가능! (데드락 위험)
+    // ✅ 비동기 콜백 사용
+    if (gsm_tcp_read(gsm, cid, GSM_TCP_PBUF_BLOCK_SIZE,
+                     tcp_read_complete_callback) == 0) {
+      return;
     }
-    xSemaphoreGive(gsm->tcp.tcp_mutex);
+
+    // 소켓이 연결 상태가 아님 - 다음 소켓으로
+    gsm->tcp.read_cid = GSM_TCP_READ_IDLE;
   }
 }
 
@@ -1134,6 +1371,7 @@ static void tcp_read_complete_callback(gsm_t *gsm, gsm_cmd_t cmd, void *msg,
  *
  * 역할:
  * - +QIURC: "recv" 이벤트 수신 시 AT+QIRD로 데이터 읽기
+ *   (+QIRD: 0 이 나올 때까지 연속으로 읽어 한 번에 비움)
  * - +QIURC: "closed" 이벤트 수신 시 소켓 정리
  * - 데드락 방지: 별도 태스크이므로 동기 함수 호출 가능
  */
@@ -1145,19 +1383,43 @@ static void gsm_tcp_task(void *arg) {
     if (xQueueReceive(gsm->tcp.event_queue, &evt, portMAX_DELAY) == pdTRUE) {
       switch (evt.type) {
       case TCP_EVT_RECV_NOTIFY: {
-        // ✅ 여기서는 동기 호출 불가능! (데드락 위험)
-        // ✅ 비동기 콜백 사용
+        // 읽기 진행 중이면 비트만 세워두고 완료 후 이어서 읽음
+        // (연속된 "recv" URC는 하나의 읽기 루프로 합쳐짐)
         if (evt.connect_id < GSM_TCP_MAX_SOCKETS) {
-          gsm_tcp_read(gsm, evt.connect_id, 1460, tcp_read_complete_callback);
+          gsm->tcp.read_pending |= (uint16_t)(1U << evt.connect_id);
+          tcp_read_kick(gsm);
+        }
+        break;
+      }
+
+      case TCP_EVT_READ_MORE:
+      case TCP_EVT_READ_DONE: {
+        uint8_t cid = gsm->tcp.read_cid;
+        gsm->tcp.read_cid = GSM_TCP_READ_IDLE;
+
+        // ★ 모뎀 버퍼가 빌 때까지 (+QIRD: 0) AT+QIRD 반복
+        // 블록 부족으로 끊긴 경우도 대기 비트를 유지해 블록 반환 후 재개
+        if ((evt.type == TCP_EVT_READ_MORE || gsm->tcp.read_nomem) &&
+            cid < GSM_TCP_MAX_SOCKETS) {
+          gsm->tcp.read_pending |= (uint16_t)(1U << cid);
         }
+        gsm->tcp.read_nomem = false;
+        tcp_read_kick(gsm);
         break;
       }
 
+      case TCP_EVT_PBUF_FREE:
+        tcp_read_kick(gsm);
+        break;
+
       case TCP_EVT_CLOSED_NOTIFY: {
         if (xSemaphoreTake(gsm->tcp.tcp_mutex, portMAX_DELAY) == pdTRUE) {
           if (evt.connect_id < GSM_TCP_MAX_SOCKETS) {
             gsm_tcp_socket_t *socket = &gsm->tcp.sockets[evt.connect_id];
 
+            // 대기 중인 읽기 취소
+            gsm->tcp.read_pending &= (uint16_t)~(1U << evt.connect_id);
+
             // pbuf 정리
             tcp_pbuf_free_chain(socket->pbuf_head);
             socket->pbuf_head = NULL;
@@ -1201,6 +1463,9 @@ void gsm_tcp_init(gsm_t *gsm) {
   // TCP 뮤텍스 생성
   gsm->tcp.tcp_mutex = xSemaphoreCreateMutex();
 
+  // pbuf 풀 초기화
+  tcp_pbuf_pool_init();
+
   // 모든 소켓 초기화
   for (int i = 0; i < GSM_TCP_MAX_SOCKETS; i++) {
     gsm->tcp.sockets[i].connect_id = i;
@@ -1218,6 +1483,12 @@ void gsm_tcp_init(gsm_t *gsm) {
   // TCP 버퍼 초기화
   memset(&gsm->tcp.buffer, 0, sizeof(gsm_tcp_buffer_t));
 
+  // QIRD 파이프라인 초기화
+  gsm->tcp.read_cid = GSM_TCP_READ_IDLE;
+  gsm->tcp.read_pending = 0;
+  gsm->tcp.read_start = 0;
+  gsm->tcp.read_nomem = false;
+
   // TCP 이벤트 큐 생성
   gsm->tcp.event_queue = xQueueCreate(15, sizeof(tcp_event_t));
 
@@ -1276,8 +1547,9 @@ int gsm_tcp_open(gsm_t *gsm, uint8_t connect_id, uint8_t context_id,
       .tx_pbuf = NULL, // TCP 아님
   };
 
-  snprintf(msg.params, GSM_AT_CMD_PARAM_SIZE, "%d,%d,\"TCP\",\"%s\",%d,%d,0",
-           context_id, connect_id, remote_ip, remote_port, local_port);
+  snprintf(msg.params, GSM_AT_CMD_PARAM_SIZE, "%d,%d,\"TCP\",\"%s\",%d,%d,%d",
+           context_id, connect_id, remote_ip, remote_port, local_port,
+           GSM_TCP_ACCESS_MODE);
 
   if (callback) {
     // 비동기식
@@ -1602,7 +1874,7 @@ int gsm_tcp_close_force(gsm_t *gsm, uint8_t connect_id) {
 int gsm_tcp_send(gsm_t *gsm, uint8_t connect_id, const uint8_t *data,
                  size_t len, at_cmd_handler callback) {
   if (!gsm || connect_id >= GSM_TCP_MAX_SOCKETS || !data || len == 0 ||
-      len > 1460) {
+      len > GSM_TCP_PBUF_BLOCK_SIZE) {
     return -1;
   }
 
@@ -20,6 +20,22 @@
 
 #define GSM_TCP_PBUF_MAX_LEN (16 * 1024) // 소켓당 최대 16KB
 
+#define GSM_TCP_PBUF_BLOCK_SIZE 1460 ///< pbuf 블록 크기 (TCP 최대 세그먼트)
+#define GSM_TCP_PBUF_POOL_SIZE 8     ///< pbuf 풀 블록 개수
+#define GSM_TCP_READ_IDLE 0xFF       ///< 진행 중인 QIRD 없음
+
+/**
+ * @brief QIOPEN access_mode
+ * - 0: buffer access  (+QIURC: "recv",<id> → AT+QIRD로 읽기)
+ * - 1: direct push    (+QIURC: "recv",<id>,<len>\r\n<data> 로 바로 수신)
+ */
+#define GSM_TCP_ACCESS_BUFFER 0
+#define GSM_TCP_ACCESS_DIRECT_PUSH 1
+
+#ifndef GSM_TCP_ACCESS_MODE
+#define GSM_TCP_ACCESS_MODE GSM_TCP_ACCESS_BUFFER
+#endif
+
 typedef struct gsm_s gsm_t;
 
 typedef enum {
@@ -71,6 +87,15 @@ typedef struct tcp_pbuf_s {
   struct tcp_pbuf_s *next; ///< 다음 pbuf
 } tcp_pbuf_t;
 
+// pbuf 풀 통계
+typedef struct {
+  uint16_t total;        ///< 전체 블록 수
+  uint16_t in_use;       ///< 사용 중인 블록 수
+  uint16_t high_water;   ///< 최대 사용 블록 수
+  uint32_t alloc_failed; ///< 할당 실패 횟수 (풀 부족 또는 크기 초과)
+  uint32_t rx_dropped;   ///< 블록 부족으로 버린 수신 바이트 수
+} tcp_pbuf_pool_stats_t;
+
 typedef struct {
   const char *prefix;    ///< GSM 명령어
   urc_handler_t handler; ///< GSM 명령어 처리 핸들러
@@ -241,7 +266,8 @@ typedef struct {
 typedef struct {
   int (*init)(void);
   int (*reset)(void);
-  int (*send)(const char *data, size_t len);
+  int (*send)(const char *data, size_t len);       // 전송 완료까지 대기
+  int (*send_async)(const char *data, size_t len); // 송신 링에 넣고 즉시 반환
   int (*recv)(char *buf, size_t len);
 } gsm_hal_ops_t;
 
@@ -259,6 +285,9 @@ typedef void (*tcp_close_callback_t)(uint8_t connect_id);
 typedef enum {
   TCP_EVT_RECV_NOTIFY = 0, ///< +QIURC: "recv" 수신 알림
   TCP_EVT_CLOSED_NOTIFY,   ///< +QIURC: "closed" 종료 알림
+  TCP_EVT_READ_MORE,       ///< QIRD 완료 (데이터 있음 → 이어서 읽기)
+  TCP_EVT_READ_DONE,       ///< QIRD 완료 (0 바이트 또는 에러 → 읽기 종료)
+  TCP_EVT_PBUF_FREE,       ///< pbuf 블록 반환 (블록 부족으로 멈춘 읽기 재개)
 } tcp_event_type_t;
 
 // TCP 이벤트 구조체
@@ -308,6 +337,8 @@ typedef struct {
   size_t expected_data_len;   ///< 예상 데이터 길이
   size_t read_data_len;       ///< 읽은 데이터 길이
   uint8_t current_connect_id; ///< 현재 읽기 중인 소켓 ID
+  bool is_push;               ///< direct push 데이터 (QIRD 응답 아님)
+  size_t discard_len;         ///< 버릴 push 데이터 남은 길이 (길이/ID 오류)
 } gsm_tcp_buffer_t;
 
 // TCP 관리 구조체
@@ -319,6 +350,12 @@ typedef struct {
   // TCP 전용 태스크
   QueueHandle_t event_queue; ///< TCP 이벤트 큐
   TaskHandle_t task_handle;  ///< TCP 태스크 핸들
+
+  // QIRD 파이프라인 상태 (gsm_tcp_task 전용)
+  uint8_t read_cid;       ///< 읽기 진행 중인 소켓 ID (GSM_TCP_READ_IDLE=없음)
+  uint16_t read_pending;  ///< 읽기 대기 중인 소켓 비트맵
+  TickType_t read_start;  ///< 현재 QIRD 발행 시각 (응답 유실 감지용)
+  volatile bool read_nomem; ///< 마지막 QIRD 데이터를 블록 부족으로 버림
 } gsm_tcp_t;
 
 typedef struct gsm_s {
@@ -421,7 +458,9 @@ gsm_tcp_socket_t *gsm_tcp_get_socket(gsm_t *gsm, uint8_t connect_id);
 /**
  * @brief pbuf 할당
  *
- * @param len 데이터 길이
+ * 고정 크기 블록 풀에서 O(1)로 할당한다. 태스크 컨텍스트에서만 호출.
+ *
+ * @param len 데이터 길이 (GSM_TCP_PBUF_BLOCK_SIZE 이하)
  * @return tcp_pbuf_t* 할당된 pbuf (NULL이면 실패)
  */
 tcp_pbuf_t *tcp_pbuf_alloc(size_t len);
@@ -433,6 +472,13 @@ tcp_pbuf_t *tcp_pbuf_alloc(size_t len);
  */
 void tcp_pbuf_free(tcp_pbuf_t *pbuf);
 
+/**
+ * @brief pbuf 풀 통계 조회
+ *
+ * @param stats 통계 출력
+ */
+void tcp_pbuf_pool_get_stats(tcp_pbuf_pool_stats_t *stats);
+
 /**
  * @brief pbuf 체인 전체 해제
  *
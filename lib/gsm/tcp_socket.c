@@ -11,17 +11,25 @@ struct tcp_socket_s {
   bool is_connected;
   bool is_closed_by_peer; // 서버가 종료한 경우
 
-  // 수신 데이터 큐 (pbuf 포인터 저장)
-  QueueHandle_t rx_queue;
+  // 수신 링 버퍼 (SPSC)
+  // - 쓰기: tcp_mutex를 잡은 쪽 (GSM TCP 태스크 콜백 / 보류분 이동)
+  // - 읽기: tcp_recv()를 호출하는 애플리케이션 태스크 (락 없음)
+  uint8_t rx_ring[TCP_SOCKET_RX_RING_SIZE];
+  volatile uint32_t rx_head; ///< 쓰기 인덱스 (계속 증가, 마스크로 접근)
+  volatile uint32_t rx_tail; ///< 읽기 인덱스 (계속 증가, 마스크로 접근)
+  SemaphoreHandle_t rx_sem;  ///< 데이터 도착/종료 알림 (바이너리)
   SemaphoreHandle_t mutex;
 
   // 기본 수신 타임아웃 (ms)
   uint32_t default_recv_timeout;
 };
 
+#define RX_RING_MASK (TCP_SOCKET_RX_RING_SIZE - 1)
+
 // 내부 콜백 (forward declaration)
 static void _internal_recv_callback(uint8_t connect_id);
 static void _internal_close_callback(uint8_t connect_id);
+static size_t _rx_fill(tcp_socket_t *sock);
 
 // 소켓 인스턴스 배열 (콜백에서 접근용)
 static tcp_socket_t *g_sockets[GSM_TCP_MAX_SOCKETS] = {NULL};
@@ -47,16 +55,16 @@ tcp_socket_t *tcp_socket_create(gsm_t *gsm, uint8_t connect_id) {
   sock->is_closed_by_peer = false;
   sock->default_recv_timeout = 5000; // 기본 5초
 
-  // 수신 큐 생성 (최대 10개 pbuf 저장)
-  sock->rx_queue = xQueueCreate(10, sizeof(tcp_pbuf_t *));
-  if (!sock->rx_queue) {
+  // 수신 알림 세마포어 생성 (링 버퍼는 구조체에 포함)
+  sock->rx_sem = xSemaphoreCreateBinary();
+  if (!sock->rx_sem) {
     vPortFree(sock);
     return NULL;
   }
 
   sock->mutex = xSemaphoreCreateMutex();
   if (!sock->mutex) {
-    vQueueDelete(sock->rx_queue);
+    vSemaphoreDelete(sock->rx_sem);
     vPortFree(sock);
     return NULL;
   }
@@ -73,6 +81,11 @@ int tcp_connect(tcp_socket_t *sock, uint8_t context_id, const char *remote_ip,
     return -1;
   }
 
+  // 이전 연결의 잔여 데이터/알림 정리 (콜백 등록 전이므로 안전)
+  sock->rx_head = 0;
+  sock->rx_tail = 0;
+  xSemaphoreTake(sock->rx_sem, 0);
+
   // ★ 내부 콜백 등록하여 gsm_tcp_open() 호출
   int ret = gsm_tcp_open(sock->gsm, sock->connect_id, context_id, remote_ip,
                          remote_port,
@@ -121,12 +134,12 @@ void tcp_set_recv_timeout(tcp_socket_t *sock, uint32_t timeout_ms) {
   }
 }
 
-int tcp_recv(tcp_socket_t *sock, uint8_t *buf, size_t len,
-             uint32_t timeout_ms) {
-  if (!sock || !buf || len == 0) {
-    return -1;
-  }
-
+/**
+ * @brief 수신 데이터 대기
+ *
+ * @return int 링 버퍼에 쌓인 바이트 수 (0=타임아웃, -1=서버 종료)
+ */
+static int _rx_wait(tcp_socket_t *sock, uint32_t timeout_ms) {
   // ★ timeout_ms=0이면 기본값 사용
   if (timeout_ms == 0) {
     if (xSemaphoreTake(sock->mutex, portMAX_DELAY) == pdTRUE) {
@@ -139,42 +152,104 @@ int tcp_recv(tcp_socket_t *sock, uint8_t *buf, size_t len,
 
   TickType_t timeout_ticks =
       (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+  TimeOut_t timeout;
+  vTaskSetTimeOutState(&timeout);
 
-  // ★ 큐에서 pbuf 꺼내기 (블로킹)
-  tcp_pbuf_t *pbuf = NULL;
-  if (xQueueReceive(sock->rx_queue, &pbuf, timeout_ticks) == pdTRUE) {
-    if (!pbuf) {
-      return -1; // NULL pbuf (에러)
+  while (1) {
+    uint32_t used = sock->rx_head - sock->rx_tail;
+    if (used > 0) {
+      return (int)used;
     }
 
-    // 데이터 복사
-    size_t copy_len = (pbuf->len < len) ? pbuf->len : len;
-    memcpy(buf, pbuf->payload, copy_len);
-
-    // if(pbuf->len > copy_len)
-    // {
-    //     // 남은 데이터로 새 pbuf 생성
-    //     size_t remaining = pbuf->len - copy_len;
-    //     tcp_pbuf_t *new_pbuf = tcp_pbuf_alloc(remaining);
-    //     if(new_pbuf)
-    //     {
-    //         memcpy(new_pbuf->payload, pbuf->payload + copy_len, remaining);
-    //         // 큐 앞에 넣기 (다음 recv에서 먼저 읽힘)
-    //         xQueueSendToFront(sock->rx_queue, &new_pbuf, 0);
-    //     }
-    //     // 메모리 부족 시 남은 데이터 손실 (어쩔 수 없음)
-    // }
-
-    // pbuf 해제
-    tcp_pbuf_free(pbuf);
-
-    return (int)copy_len;
-  } else {
-    // 타임아웃
-    return 0;
+    // 남은 데이터를 모두 읽은 뒤에 종료 보고
+    if (sock->is_closed_by_peer) {
+      return -1;
+    }
+
+    if (xTaskCheckForTimeOut(&timeout, &timeout_ticks) == pdTRUE) {
+      return 0; // 타임아웃
+    }
+
+    xSemaphoreTake(sock->rx_sem, timeout_ticks);
+  }
+}
+
+/**
+ * @brief 읽기 인덱스 전진 후 보류 데이터 이동
+ */
+static void _rx_advance(tcp_socket_t *sock, size_t len) {
+  // 데이터 읽기가 끝난 뒤 인덱스 갱신
+  portMEMORY_BARRIER();
+  sock->rx_tail += (uint32_t)len;
+
+  // 링이 가득 차 pbuf 체인에 남겨둔 데이터가 있으면 이어서 옮김
+  if (sock->gsm->tcp.sockets[sock->connect_id].pbuf_head) {
+    _rx_fill(sock);
   }
 }
 
+int tcp_recv(tcp_socket_t *sock, uint8_t *buf, size_t len,
+             uint32_t timeout_ms) {
+  if (!sock || !buf || len == 0) {
+    return -1;
+  }
+
+  int avail = _rx_wait(sock, timeout_ms);
+  if (avail <= 0) {
+    return avail;
+  }
+
+  // 요청 크기만큼만 복사, 나머지는 링에 남김
+  size_t copy_len = ((size_t)avail < len) ? (size_t)avail : len;
+  uint32_t idx = sock->rx_tail & RX_RING_MASK;
+  size_t first = TCP_SOCKET_RX_RING_SIZE - idx;
+  if (first > copy_len) {
+    first = copy_len;
+  }
+
+  memcpy(buf, &sock->rx_ring[idx], first);
+  memcpy(buf + first, sock->rx_ring, copy_len - first);
+
+  _rx_advance(sock, copy_len);
+
+  return (int)copy_len;
+}
+
+int tcp_recv_zero_copy(tcp_socket_t *sock, const uint8_t **data,
+                       uint32_t timeout_ms) {
+  if (!sock || !data) {
+    return -1;
+  }
+
+  int avail = _rx_wait(sock, timeout_ms);
+  if (avail <= 0) {
+    return avail;
+  }
+
+  // 링 끝까지의 연속 구간만 반환
+  uint32_t idx = sock->rx_tail & RX_RING_MASK;
+  size_t span = TCP_SOCKET_RX_RING_SIZE - idx;
+  if (span > (size_t)avail) {
+    span = (size_t)avail;
+  }
+
+  *data = &sock->rx_ring[idx];
+  return (int)span;
+}
+
+void tcp_recv_consume(tcp_socket_t *sock, size_t len) {
+  if (!sock || len == 0) {
+    return;
+  }
+
+  uint32_t used = sock->rx_head - sock->rx_tail;
+  if (len > used) {
+    len = used;
+  }
+
+  _rx_advance(sock, len);
+}
+
 int tcp_close(tcp_socket_t *sock) {
   if (!sock) {
     return -1;
@@ -237,19 +312,11 @@ void tcp_socket_destroy(tcp_socket_t *sock) {
     tcp_close(sock);
   }
 
-  // 큐에 남은 pbuf 모두 해제
-  tcp_pbuf_t *pbuf;
-  while (xQueueReceive(sock->rx_queue, &pbuf, 0) == pdTRUE) {
-    if (pbuf) {
-      tcp_pbuf_free(pbuf);
-    }
-  }
-
   // 전역 배열에서 제거
   g_sockets[sock->connect_id] = NULL;
 
-  // 리소스 해제
-  vQueueDelete(sock->rx_queue);
+  // 리소스 해제 (링 버퍼는 구조체와 함께 해제)
+  vSemaphoreDelete(sock->rx_sem);
   vSemaphoreDelete(sock->mutex);
   vPortFree(sock);
 }
@@ -259,18 +326,97 @@ size_t tcp_available(tcp_socket_t *sock) {
     return 0;
   }
 
-  return uxQueueMessagesWaiting(sock->rx_queue);
+  return sock->rx_head - sock->rx_tail;
+}
+
+size_t tcp_pending(tcp_socket_t *sock) {
+  if (!sock) {
+    return 0;
+  }
+
+  return sock->gsm->tcp.sockets[sock->connect_id].pbuf_total_len;
 }
 
 //=============================================================================
 // 내부 콜백 (gsm_tcp_open에서 호출됨)
 //=============================================================================
 
+/**
+ * @brief 링 버퍼에 데이터 쓰기 (tcp_mutex 보유 상태에서 호출)
+ *
+ * @return size_t 실제로 쓴 바이트 수 (빈 공간만큼)
+ */
+static size_t _rx_ring_write(tcp_socket_t *sock, const uint8_t *data,
+                             size_t len) {
+  uint32_t head = sock->rx_head;
+  size_t space = TCP_SOCKET_RX_RING_SIZE - (head - sock->rx_tail);
+  if (len > space) {
+    len = space;
+  }
+
+  uint32_t idx = head & RX_RING_MASK;
+  size_t first = TCP_SOCKET_RX_RING_SIZE - idx;
+  if (first > len) {
+    first = len;
+  }
+
+  memcpy(&sock->rx_ring[idx], data, first);
+  memcpy(sock->rx_ring, data + first, len - first);
+
+  // 데이터 쓰기가 끝난 뒤 인덱스 공개
+  portMEMORY_BARRIER();
+  sock->rx_head = head + (uint32_t)len;
+
+  return len;
+}
+
+/**
+ * @brief GSM 소켓의 pbuf 체인을 링 버퍼로 이동
+ *
+ * 링이 가득 차면 남은 부분은 pbuf에 그대로 두고 (payload 전진)
+ * 애플리케이션이 읽어서 공간이 생길 때 다시 호출된다.
+ *
+ * @return size_t 이동한 바이트 수
+ */
+static size_t _rx_fill(tcp_socket_t *sock) {
+  gsm_tcp_socket_t *gs = &sock->gsm->tcp.sockets[sock->connect_id];
+  size_t moved = 0;
+
+  if (xSemaphoreTake(sock->gsm->tcp.tcp_mutex, portMAX_DELAY) != pdTRUE) {
+    return 0;
+  }
+
+  tcp_pbuf_t *pbuf;
+  while ((pbuf = gs->pbuf_head) != NULL) {
+    size_t n = _rx_ring_write(sock, pbuf->payload, pbuf->len);
+    moved += n;
+
+    if (n < pbuf->len) {
+      // 링 가득 참 - 남은 데이터는 보류 (버리지 않음)
+      pbuf->payload += n;
+      pbuf->len -= n;
+      pbuf->tot_len = pbuf->len;
+      gs->pbuf_total_len -= n;
+      break;
+    }
+
+    tcp_pbuf_free(tcp_pbuf_dequeue(gs));
+  }
+
+  xSemaphoreGive(sock->gsm->tcp.tcp_mutex);
+
+  if (moved > 0) {
+    xSemaphoreGive(sock->rx_sem);
+  }
+
+  return moved;
+}
+
 /**
  * @brief 내부 수신 콜백
  *
  * gsm_tcp_read() 완료 시 호출됨
- * → pbuf를 큐에 추가하여 tcp_recv()에서 읽을 수 있게 함
+ * → pbuf 데이터를 링 버퍼로 옮기고 pbuf는 즉시 풀에 반환
  */
 static void _internal_recv_callback(uint8_t connect_id) {
   if (connect_id >= GSM_TCP_MAX_SOCKETS) {
@@ -282,24 +428,7 @@ static void _internal_recv_callback(uint8_t connect_id) {
     return;
   }
 
-  tcp_pbuf_t *pbuf = NULL;
-  if (xSemaphoreTake(sock->gsm->tcp.tcp_mutex, portMAX_DELAY) == pdTRUE) {
-    pbuf = tcp_pbuf_dequeue(&sock->gsm->tcp.sockets[connect_id]);
-    xSemaphoreGive(sock->gsm->tcp.tcp_mutex);
-  }
-
-  if (!pbuf) {
-    return; // 데이터 없음
-  }
-
-  // ★ rx_queue에 pbuf 포인터 추가
-  if (xQueueSend(sock->rx_queue, &pbuf, 0) != pdTRUE) {
-    // 큐 가득 참 - pbuf 버림
-    tcp_pbuf_free(pbuf);
-
-    // 메모리 오버플로우 방지: 애플리케이션이 수신 속도를 따라가지 못함
-    // 해결: tcp_recv() 호출 주기를 줄이거나 큐 크기 증가 필요
-  }
+  _rx_fill(sock);
 }
 
 /**
@@ -323,9 +452,8 @@ static void _internal_close_callback(uint8_t connect_id) {
     xSemaphoreGive(sock->mutex);
   }
 
-  // ★ NULL pbuf를 큐에 넣어 tcp_recv() 깨우기 (종료 알림)
-  tcp_pbuf_t *null_pbuf = NULL;
-  xQueueSend(sock->rx_queue, &null_pbuf, 0);
+  // ★ tcp_recv() 깨우기 (남은 데이터를 다 읽으면 -1 반환)
+  xSemaphoreGive(sock->rx_sem);
 }
 
 gsm_tcp_state_t tcp_get_socket_state(tcp_socket_t *sock, uint8_t id) {
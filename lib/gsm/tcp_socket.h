@@ -14,9 +14,17 @@
  * 목적:
  * - 애플리케이션 태스크에서 쉽게 TCP 통신
  * - 콜백 없이 동기식 send/recv 제공
- * - 내부적으로 큐/세마포어로 동기화
+ * - 내부적으로 소켓별 바이트 링 버퍼 + 세마포어로 동기화
  */
 
+#ifndef TCP_SOCKET_RX_RING_SIZE
+#define TCP_SOCKET_RX_RING_SIZE 4096 ///< 소켓별 수신 링 버퍼 크기 (2의 거듭제곱)
+#endif
+
+#if (TCP_SOCKET_RX_RING_SIZE & (TCP_SOCKET_RX_RING_SIZE - 1)) != 0
+#error "TCP_SOCKET_RX_RING_SIZE must be a power of two"
+#endif
+
 typedef struct tcp_socket_s tcp_socket_t;
 
 /**
@@ -70,9 +78,34 @@ void tcp_set_recv_timeout(tcp_socket_t *sock, uint32_t timeout_ms);
  *
  * @note timeout_ms=0이면 소켓의 기본 timeout 사용
  *       기본값은 tcp_set_recv_timeout()으로 설정 (기본: 5000ms)
+ * @note buf보다 많은 데이터가 있으면 나머지는 링 버퍼에 남아
+ *       다음 tcp_recv()에서 이어서 읽힘 (손실 없음)
  */
 int tcp_recv(tcp_socket_t *sock, uint8_t *buf, size_t len, uint32_t timeout_ms);
 
+/**
+ * @brief TCP 데이터 zero-copy 수신 (블로킹)
+ *
+ * 링 버퍼 안의 연속 구간을 복사 없이 노출한다.
+ * 사용이 끝나면 tcp_recv_consume()으로 소비한 길이만큼 해제해야 함.
+ * 링 끝에서 wrap된 데이터는 다음 호출에서 두 번째 구간으로 반환됨.
+ *
+ * @param sock 소켓 핸들
+ * @param data [out] 연속 구간 시작 포인터
+ * @param timeout_ms 타임아웃 (ms, 0=소켓 기본값 사용)
+ * @return int 연속 구간 길이 (0=타임아웃, -1=에러)
+ */
+int tcp_recv_zero_copy(tcp_socket_t *sock, const uint8_t **data,
+                       uint32_t timeout_ms);
+
+/**
+ * @brief tcp_recv_zero_copy()로 얻은 구간 소비
+ *
+ * @param sock 소켓 핸들
+ * @param len 소비한 바이트 수 (반환된 구간 길이 이하)
+ */
+void tcp_recv_consume(tcp_socket_t *sock, size_t len);
+
 /**
  * @brief TCP 연결 종료
  *
@@ -94,10 +127,21 @@ void tcp_socket_destroy(tcp_socket_t *sock);
  * @brief 수신 가능한 데이터 크기 확인
  *
  * @param sock 소켓 핸들
- * @return size_t 수신 가능한 바이트 수
+ * @return size_t 링 버퍼에 쌓인 바이트 수
  */
 size_t tcp_available(tcp_socket_t *sock);
 
+/**
+ * @brief 링 버퍼 부족으로 GSM 계층에 보류 중인 바이트 수
+ *
+ * 링이 가득 차면 데이터는 버리지 않고 pbuf 체인에 남겨두었다가
+ * 애플리케이션이 읽어 공간이 생기면 이어서 옮긴다.
+ *
+ * @param sock 소켓 핸들
+ * @return size_t 보류 중인 바이트 수
+ */
+size_t tcp_pending(tcp_socket_t *sock);
+
 gsm_tcp_state_t tcp_get_socket_state(tcp_socket_t *sock, uint8_t id);
 
 #endif // TCP_SOCKET_H
@@ -0,0 +1,553 @@
+#include "log.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdarg.h>
+#include <string.h>
+
+/**
+ * @brief 로그 링 버퍼
+ *
+ * 생산자(LOG_* 호출 태스크)는 critical section 안에서 줄 단위로 head를 전진시키고,
+ * 소비자(drain 태스크) 하나만 tail을 전진시킨다.
+ * 포맷은 critical section 밖에서 호출 태스크 스택에 한다.
+ */
+typedef struct {
+  char buf[LOG_BUF_SIZE];
+  volatile size_t head;
+  volatile size_t tail;
+  volatile uint32_t dropped;
+} log_ring_t;
+
+typedef struct {
+  const char *tag;
+  log_level_t level;
+} log_module_t;
+
+static log_ring_t log_ring;
+static log_output_t log_output = NULL;
+static TaskHandle_t log_task_handle = NULL;
+
+static log_module_t log_modules[LOG_MODULE_MAX];
+static uint8_t log_module_cnt = 0;
+static log_level_t log_default_level = LOG_LEVEL;
+
+#ifdef LOG_TOKENIZED
+static const char log_dropped_entry[] LOG_FMT_SECTION =
+    LOG_STR(LOG_LEVEL_WARNING) LOG_TOKEN_SEP "LOG" LOG_TOKEN_SEP
+    "%u lines dropped";
+#endif
+
+static const char *const log_level_prefix[] = {
+  "", COLOR_RED "[%u][E][%s]", COLOR_YELLOW "[%u][W][%s]", "[%u][I][%s]",
+  COLOR_GREEN "[%u][D][%s]",
+};
+
+/**
+ * @brief 줄 끝 (색상 복원 + 개행)
+ */
+static const char *log_line_end(log_level_t level) {
+  return (level == LOG_LEVEL_INFO) ? "\r\n" : COLOR_RESET "\r\n";
+}
+
+/**
+ * @brief 완성된 줄을 링에 복사
+ *
+ * 공간이 없으면 줄 전체를 버린다 (잘린 줄이 섞이지 않도록).
+ *
+ * @param line 줄
+ * @param len 길이
+ */
+static void log_ring_put(const char *line, size_t len) {
+  size_t head;
+  size_t space;
+  size_t n;
+
+  taskENTER_CRITICAL();
+  head = log_ring.head;
+  space = (log_ring.tail + LOG_BUF_SIZE - head - 1) % LOG_BUF_SIZE;
+
+  if (len > space) {
+    log_ring.dropped++;
+    taskEXIT_CRITICAL();
+    return;
+  }
+
+  n = LOG_BUF_SIZE - head;
+  if (n > len) {
+    n = len;
+  }
+  memcpy(&log_ring.buf[head], line, n);
+  memcpy(log_ring.buf, &line[n], len - n);
+  log_ring.head = (head + len) % LOG_BUF_SIZE;
+  taskEXIT_CRITICAL();
+
+  if (log_task_handle) {
+    xTaskNotifyGive(log_task_handle);
+  }
+}
+
+/**
+ * @brief 줄 머리 ([tick][L][TAG]) 포맷
+ *
+ * @return size_t 쓴 길이
+ */
+static size_t log_format_prefix(char *line, log_level_t level,
+                                const char *tag) {
+  int n;
+
+  if (level > LOG_LEVEL_DEBUG) {
+    level = LOG_LEVEL_DEBUG;
+  }
+
+  n = snprintf(line, LOG_LINE_MAX, log_level_prefix[level],
+               (unsigned)HAL_GetTick(), tag);
+
+  return (n < 0) ? 0 : ((size_t)n >= LOG_LINE_MAX ? LOG_LINE_MAX - 1 : n);
+}
+
+/**
+ * @brief 줄 끝을 붙여 링에 넣음 (넘치면 본문을 잘라 자리 확보)
+ */
+static void log_finish_line(char *line, size_t pos, log_level_t level) {
+  const char *end = log_line_end(level);
+  size_t end_len = strlen(end);
+
+  if (pos > LOG_LINE_MAX - end_len) {
+    pos = LOG_LINE_MAX - end_len;
+  }
+
+  memcpy(&line[pos], end, end_len);
+  log_ring_put(line, pos + end_len);
+}
+
+/**
+ * @brief 링에 쌓인 로그 출력
+ */
+static void log_drain(void) {
+  while (log_ring.tail != log_ring.head) {
+    size_t tail = log_ring.tail;
+    size_t head = log_ring.head;
+    size_t len = (head > tail) ? (head - tail) : (LOG_BUF_SIZE - tail);
+
+    if (log_output) {
+      log_output(&log_ring.buf[tail], len);
+    }
+
+    log_ring.tail = (tail + len) % LOG_BUF_SIZE;
+  }
+}
+
+static void log_task(void *pvParameter) {
+  (void)pvParameter;
+  uint32_t reported = 0;
+
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_FLUSH_PERIOD_MS));
+    log_drain();
+
+    uint32_t dropped = log_ring.dropped;
+    if (dropped != reported && log_output) {
+#ifdef LOG_TOKENIZED
+      // 링에 넣어 다음 주기에 출력 (바이너리 스트림에 텍스트를 섞지 않음)
+      log_write_token(LOG_LEVEL_WARNING, "LOG", log_dropped_entry,
+                      (unsigned)(dropped - reported));
+#else
+      char msg[48];
+      int n = snprintf(msg, sizeof(msg), "[log] %u lines dropped\r\n",
+                       (unsigned)(dropped - reported));
+      log_output(msg, (size_t)n);
+#endif
+      reported = dropped;
+    }
+  }
+}
+
+void log_init(void) {
+  if (log_task_handle) {
+    return;
+  }
+
+  // 가장 낮은 우선순위: 로그 출력이 다른 태스크 타이밍을 바꾸지 않도록
+  xTaskCreate(log_task, "log", configMINIMAL_STACK_SIZE * 4, NULL,
+              tskIDLE_PRIORITY, &log_task_handle);
+}
+
+void log_set_output(log_output_t out) {
+  log_output = out;
+}
+
+int log_set_level(const char *tag, log_level_t level) {
+  if (!tag) {
+    log_default_level = level;
+    return 0;
+  }
+
+  for (uint8_t i = 0; i < log_module_cnt; i++) {
+    if (strcmp(log_modules[i].tag, tag) == 0) {
+      log_modules[i].level = level;
+      return 0;
+    }
+  }
+
+  if (log_module_cnt >= LOG_MODULE_MAX) {
+    return -1;
+  }
+
+  // 항목을 채운 뒤 개수를 늘려 읽는 쪽이 빈 항목을 보지 않게 함
+  log_modules[log_module_cnt].tag = tag;
+  log_modules[log_module_cnt].level = level;
+  log_module_cnt++;
+
+  return 0;
+}
+
+log_level_t log_get_level(const char *tag) {
+  for (uint8_t i = 0; i < log_module_cnt; i++) {
+    if (log_modules[i].tag == tag || strcmp(log_modules[i].tag, tag) == 0) {
+      return log_modules[i].level;
+    }
+  }
+
+  return log_default_level;
+}
+
+void log_write(log_level_t level, const char *tag, const char *fmt, ...) {
+  char line[LOG_LINE_MAX];
+  size_t pos;
+  va_list ap;
+  int n;
+
+  if (level > log_get_level(tag)) {
+    return;
+  }
+
+  pos = log_format_prefix(line, level, tag);
+
+  va_start(ap, fmt);
+  n = vsnprintf(&line[pos], LOG_LINE_MAX - pos, fmt, ap);
+  va_end(ap);
+
+  if (n > 0) {
+    pos += (size_t)n;
+  }
+
+  log_finish_line(line, pos, level);
+}
+
+void log_write_data(log_level_t level, const char *tag, const char *prefix,
+                    const void *data, size_t len, bool hex) {
+  static const char hex_chars[] = "0123456789ABCDEF";
+  const uint8_t *p = (const uint8_t *)data;
+  const size_t end_len = strlen(log_line_end(level));
+  char line[LOG_LINE_MAX];
+  size_t pos;
+  size_t i = 0;
+  int n;
+
+  if (level > log_get_level(tag)) {
+    return;
+  }
+
+  pos = log_format_prefix(line, level, tag);
+  n = snprintf(&line[pos], LOG_LINE_MAX - pos, hex ? "%s[%u]:" : "%s[%u]",
+               prefix, (unsigned)len);
+  if (n > 0) {
+    pos += (size_t)n;
+    if (pos > LOG_LINE_MAX - 1) {
+      pos = LOG_LINE_MAX - 1;
+    }
+  }
+
+  // 한 줄을 넘으면 여러 줄로 나눠 넣음 (이어지는 줄은 머리 없이)
+  while (i < len) {
+    uint8_t c = p[i];
+    size_t need = hex ? 3 : ((c >= 0x20 && c < 0x7F) || c == '\r' || c == '\n')
+                                ? 1
+                                : 4;
+
+    if (pos + need + end_len > LOG_LINE_MAX) {
+      log_finish_line(line, pos, level);
+      pos = 0;
+    }
+
+    if (hex) {
+      line[pos++] = ' ';
+      line[pos++] = hex_chars[c >> 4];
+      line[pos++] = hex_chars[c & 0x0F];
+    } else if (need == 1) {
+      line[pos++] = (char)c;
+    } else {
+      line[pos++] = '<';
+      line[pos++] = hex_chars[c >> 4];
+      line[pos++] = hex_chars[c & 0x0F];
+      line[pos++] = '>';
+    }
+    i++;
+  }
+
+  log_finish_line(line, pos, level);
+}
+
+void log_flush(void) {
+  log_drain();
+}
+
+uint32_t log_get_dropped(void) {
+  return log_ring.dropped;
+}
+
+#ifdef LOG_TOKENIZED
+/* GNU ld가 log_fmt 섹션 시작 주소로 정의 */
+extern const char __start_log_fmt[];
+
+// 0xA5 | len | id(2) | tick(4) | 인자 (len은 1바이트)
+#define LOG_TOKEN_HDR_LEN 8
+#define LOG_TOKEN_FRAME_MAX (2 + 255)
+
+/**
+ * @brief 토큰 프레임 작성기
+ */
+typedef struct {
+  uint8_t buf[LOG_TOKEN_FRAME_MAX];
+  size_t pos;
+} log_token_frame_t;
+
+static void log_token_begin(log_token_frame_t *f, const char *entry) {
+  uint16_t id = (uint16_t)(entry - __start_log_fmt);
+  uint32_t tick = (uint32_t)HAL_GetTick();
+
+  f->buf[0] = LOG_TOKEN_SYNC;
+  f->buf[2] = id & 0xFF;
+  f->buf[3] = id >> 8;
+  for (int i = 0; i < 4; i++) {
+    f->buf[4 + i] = (tick >> (8 * i)) & 0xFF;
+  }
+  f->pos = LOG_TOKEN_HDR_LEN;
+}
+
+static inline size_t log_token_space(const log_token_frame_t *f) {
+  return LOG_TOKEN_FRAME_MAX - f->pos;
+}
+
+static void log_token_put_uint(log_token_frame_t *f, uint64_t val,
+                               size_t size) {
+  if (log_token_space(f) < size) {
+    f->pos = LOG_TOKEN_FRAME_MAX;
+    return;
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    f->buf[f->pos++] = (val >> (8 * i)) & 0xFF;
+  }
+}
+
+/**
+ * @brief 길이(1바이트) + 바이트열 (공간이 모자라면 잘림)
+ *
+ * @return size_t 실제로 넣은 바이트 수
+ */
+static size_t log_token_put_bytes(log_token_frame_t *f, const void *data,
+                                  size_t len) {
+  size_t space = log_token_space(f);
+
+  if (space == 0) {
+    return 0;
+  }
+
+  space--;
+  if (len > space) {
+    len = space;
+  }
+
+  f->buf[f->pos++] = (uint8_t)len;
+  memcpy(&f->buf[f->pos], data, len);
+  f->pos += len;
+
+  return len;
+}
+
+static void log_token_end(log_token_frame_t *f) {
+  f->buf[1] = (uint8_t)(f->pos - 2);
+  log_ring_put((const char *)f->buf, f->pos);
+}
+
+/**
+ * @brief 포맷 문자열을 따라 가변 인자를 원본 바이트로 기록
+ *
+ * 변환 규칙은 tools/log_decode.py 와 같아야 한다.
+ */
+static void log_token_put_args(log_token_frame_t *f, const char *fmt,
+                               va_list ap) {
+  for (const char *p = fmt; *p; p++) {
+    if (*p != '%') {
+      continue;
+    }
+
+    p++;
+    if (*p == '%') {
+      continue;
+    }
+
+    // flags
+    while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0') {
+      p++;
+    }
+    // width / precision ('*'는 int 인자)
+    for (int part = 0; part < 2; part++) {
+      if (*p == '*') {
+        log_token_put_uint(f, (uint32_t)va_arg(ap, int), 4);
+        p++;
+      } else {
+        while (*p >= '0' && *p <= '9') {
+          p++;
+        }
+      }
+      if (part == 0 && *p == '.') {
+        p++;
+      } else {
+        break;
+      }
+    }
+
+    // length
+    int lng = 0; // 0: int, 1: long, 2: long long, 3: size_t, 4: intmax_t, 5: ptrdiff_t
+    if (*p == 'h') {
+      p++;
+      if (*p == 'h') p++;
+    } else if (*p == 'l') {
+      p++;
+      lng = 1;
+      if (*p == 'l') {
+        p++;
+        lng = 2;
+      }
+    } else if (*p == 'z') {
+      p++;
+      lng = 3;
+    } else if (*p == 'j') {
+      p++;
+      lng = 4;
+    } else if (*p == 't') {
+      p++;
+      lng = 5;
+    } else if (*p == 'L') {
+      p++;
+    }
+
+    switch (*p) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c': {
+      uint64_t v;
+      switch (lng) {
+      case 1: v = (uint64_t)va_arg(ap, long); break;
+      case 2: v = (uint64_t)va_arg(ap, long long); break;
+      case 3: v = (uint64_t)va_arg(ap, size_t); break;
+      case 4: v = (uint64_t)va_arg(ap, intmax_t); break;
+      case 5: v = (uint64_t)va_arg(ap, ptrdiff_t); break;
+      default: v = (uint64_t)va_arg(ap, int); break;
+      }
+      log_token_put_uint(f, v, (lng == 2 || lng == 4) ? 8 : 4);
+      break;
+    }
+
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G': {
+      union {
+        double d;
+        uint64_t u;
+      } v;
+      v.d = va_arg(ap, double);
+      log_token_put_uint(f, v.u, 8);
+      break;
+    }
+
+    case 's': {
+      const char *str = va_arg(ap, const char *);
+      if (!str) {
+        str = "(null)";
+      }
+      log_token_put_bytes(f, str, strnlen(str, 255));
+      break;
+    }
+
+    case 'p':
+      log_token_put_uint(f, (uint32_t)(uintptr_t)va_arg(ap, void *), 4);
+      break;
+
+    case 'n':
+      (void)va_arg(ap, void *);
+      break;
+
+    default:
+      return;
+    }
+  }
+}
+
+/**
+ * @brief "레벨\x1fTAG\x1f포맷" 에서 포맷 부분
+ */
+static const char *log_token_fmt(const char *entry) {
+  const char *p = strchr(entry, '\x1f');
+  p = p ? strchr(p + 1, '\x1f') : NULL;
+  return p ? p + 1 : entry;
+}
+
+void log_write_token(log_level_t level, const char *tag, const char *entry,
+                     ...) {
+  log_token_frame_t f;
+  va_list ap;
+
+  if (level > log_get_level(tag)) {
+    return;
+  }
+
+  log_token_begin(&f, entry);
+
+  va_start(ap, entry);
+  log_token_put_args(&f, log_token_fmt(entry), ap);
+  va_end(ap);
+
+  log_token_end(&f);
+}
+
+void log_write_token_data(log_level_t level, const char *tag,
+                          const char *entry, const char *prefix,
+                          const void *data, size_t len) {
+  static const char cont_raw[] LOG_FMT_SECTION =
+      LOG_STR(LOG_LEVEL_DEBUG) LOG_TOKEN_SEP "LOG" LOG_TOKEN_SEP "%B";
+  static const char cont_hex[] LOG_FMT_SECTION =
+      LOG_STR(LOG_LEVEL_DEBUG) LOG_TOKEN_SEP "LOG" LOG_TOKEN_SEP "%H";
+  const uint8_t *p = (const uint8_t *)data;
+  const char *fmt = log_token_fmt(entry);
+  bool hex = (fmt[strlen(fmt) - 1] == 'H');
+  log_token_frame_t f;
+  size_t n;
+
+  if (level > log_get_level(tag)) {
+    return;
+  }
+
+  log_token_begin(&f, entry);
+  log_token_put_bytes(&f, prefix, strnlen(prefix, 32));
+  log_token_put_uint(&f, (uint32_t)len, 4);
+  n = log_token_put_bytes(&f, p, len);
+  log_token_end(&f);
+
+  // 나머지는 이어지는 프레임으로 (디코더가 앞 줄에 붙여 출력)
+  while (n < len) {
+    log_token_begin(&f, hex ? cont_hex : cont_raw);
+    n += log_token_put_bytes(&f, &p[n], len - n);
+    log_token_end(&f);
+  }
+}
+#endif
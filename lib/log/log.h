@@ -2,6 +2,9 @@
 #define LOG_H
 
 #include "stm32f4xx_hal.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #ifndef TAG
@@ -14,49 +17,210 @@
 #define COLOR_GREEN "\033[32m"
 #define COLOR_RESET "\033[0m"
 
-typedef enum {
-  LOG_LEVEL_NONE = 0,
-  LOG_LEVEL_ERROR = 1,
-  LOG_LEVEL_WARNING = 2,
-  LOG_LEVEL_INFO = 3,
-  LOG_LEVEL_DEBUG = 4,
-} log_level_t;
+// #if 비교에 쓰이므로 enum이 아닌 매크로 (enum 상수는 전처리기에서 0으로 평가됨)
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARNING 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
 
+typedef uint8_t log_level_t;
+
+// 빌드 옵션으로 재정의 가능 (예: 벤치마크 빌드 -DLOG_LEVEL=0)
+#ifndef LOG_LEVEL
 #define LOG_LEVEL LOG_LEVEL_DEBUG
+#endif
 
-#if LOG_LEVEL >= LOG_LEVEL_DEBUG
-#define LOG_DEBUG(fmt, ...)                                                    \
+// 모듈별 컴파일 레벨: TAG처럼 log.h 포함 전에 정의 (LOG_LEVEL 이하로만 유효)
+#ifndef LOG_MODULE_LEVEL
+#define LOG_MODULE_LEVEL LOG_LEVEL
+#endif
+
+// 로그 링 버퍼 크기 (2의 거듭제곱일 필요 없음)
+#ifndef LOG_BUF_SIZE
+#define LOG_BUF_SIZE 4096
+#endif
+
+// 한 줄 최대 길이 (넘으면 잘림)
+#ifndef LOG_LINE_MAX
+#define LOG_LINE_MAX 160
+#endif
+
+// 런타임 레벨을 따로 지정할 수 있는 모듈(TAG) 수
+#ifndef LOG_MODULE_MAX
+#define LOG_MODULE_MAX 16
+#endif
+
+// drain 태스크 주기 [ms]
+#ifndef LOG_FLUSH_PERIOD_MS
+#define LOG_FLUSH_PERIOD_MS 20
+#endif
+
+/**
+ * @brief 로그 출력 함수 (drain 태스크에서 호출)
+ *
+ * @param data 출력할 데이터
+ * @param len 길이
+ * @return int 0 이상: 성공
+ */
+typedef int (*log_output_t)(const char *data, size_t len);
+
+/**
+ * @brief 로그 초기화 및 drain 태스크 생성
+ *
+ * 스케줄러 시작 전에 불러도 된다. 태스크가 돌기 전 로그는 링에 쌓였다가 출력된다.
+ */
+void log_init(void);
+
+/**
+ * @brief 출력 백엔드 설정 (USART6 DMA, SEGGER RTT 등)
+ *
+ * @param out 출력 함수 (NULL: 버림)
+ */
+void log_set_output(log_output_t out);
+
+/**
+ * @brief 모듈(TAG)별 런타임 레벨 설정
+ *
+ * @param tag 모듈 TAG (NULL: 기본 레벨)
+ * @param level 레벨
+ * @return int 0: 성공, -1: 테이블 가득 참
+ */
+int log_set_level(const char *tag, log_level_t level);
+
+/**
+ * @brief 모듈(TAG)의 런타임 레벨
+ *
+ * @param tag 모듈 TAG
+ * @return log_level_t 지정하지 않았으면 기본 레벨
+ */
+log_level_t log_get_level(const char *tag);
+
+/**
+ * @brief 한 줄 기록 (LOG_* 매크로에서 호출, 태스크 전용)
+ *
+ * 호출한 태스크에서 포맷만 하고 링에 복사한다. 출력은 drain 태스크가 한다.
+ * 링에 공간이 없으면 줄 단위로 버리고 개수를 센다.
+ */
+void log_write(log_level_t level, const char *tag, const char *fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+
+/**
+ * @brief 바이너리 데이터 기록 (LOG_DEBUG_HEX, LOG_DEBUG_RAW)
+ *
+ * @param level 레벨
+ * @param tag 모듈 TAG
+ * @param prefix 접두어
+ * @param data 데이터
+ * @param len 길이
+ * @param hex true: 16진수, false: 출력 가능한 문자는 그대로, 나머지는 <XX>
+ */
+void log_write_data(log_level_t level, const char *tag, const char *prefix,
+                    const void *data, size_t len, bool hex);
+
+/**
+ * @brief 링에 남은 로그를 호출한 태스크에서 바로 출력
+ *
+ * 리셋 직전 등 drain 태스크를 기다릴 수 없을 때 사용.
+ * drain 태스크와 동시에 돌면 일부 줄이 두 번 출력될 수 있다.
+ */
+void log_flush(void);
+
+/**
+ * @brief 링 공간 부족으로 버린 줄 수
+ */
+uint32_t log_get_dropped(void);
+
+/*
+ * 토큰화 로그 (빌드 옵션 -DLOG_TOKENIZED)
+ *
+ * 각 LOG_* 호출 위치의 "레벨\x1fTAG\x1f포맷" 문자열을 log_fmt 섹션에 모으고,
+ * 문자열 대신 섹션 내 오프셋(16비트 ID), 타임스탬프, 인자 원본 바이트만 보낸다.
+ * 호스트에서 tools/log_decode.py 가 ELF의 log_fmt 섹션으로 원문을 복원한다.
+ *
+ * 프레임: 0xA5 | len | id(LE16) | tick(LE32) | 인자...   (len = id부터 끝까지)
+ * 인자: 정수 4바이트 (ll/j는 8), 실수 8바이트 (double), %s는 길이 1바이트 + 문자열,
+ *       %B/%H(LOG_DEBUG_RAW/HEX 데이터)는 길이 1바이트 + 데이터
+ */
+#define LOG_TOKEN_SYNC 0xA5
+#define LOG_TOKEN_SEP "\x1f"
+
+#define LOG_STR_(x) #x
+#define LOG_STR(x) LOG_STR_(x)
+
+// 섹션 이름이 C 식별자여야 링커가 __start_log_fmt 심볼을 만들어 준다
+#define LOG_FMT_SECTION __attribute__((section("log_fmt"), used))
+
+/**
+ * @brief 토큰화 로그 기록 (LOG_* 매크로에서 호출)
+ *
+ * @param level 레벨
+ * @param tag 모듈 TAG (런타임 레벨 확인용)
+ * @param entry log_fmt 섹션의 "레벨\x1fTAG\x1f포맷" 문자열
+ */
+void log_write_token(log_level_t level, const char *tag, const char *entry,
+                     ...);
+
+/**
+ * @brief 토큰화 데이터 기록 (LOG_DEBUG_RAW/HEX)
+ *
+ * 한 프레임에 들어가지 않는 데이터는 이어지는 프레임으로 나눠 보낸다.
+ */
+void log_write_token_data(log_level_t level, const char *tag,
+                          const char *entry, const char *prefix,
+                          const void *data, size_t len);
+
+// 토큰화 모드에서도 포맷/인자 검사는 컴파일러가 하도록 (호출되지 않음)
+static inline void log_check_format(const char *fmt, ...)
+    __attribute__((format(printf, 1, 2)));
+static inline void log_check_format(const char *fmt, ...) { (void)fmt; }
+
+#ifdef LOG_TOKENIZED
+#define LOG_PRINT(level, fmt, ...)                                             \
   do {                                                                         \
-    printf(COLOR_GREEN "[%u][D][%s]" fmt COLOR_RESET "\r\n",                   \
-           (unsigned)HAL_GetTick(), TAG, ##__VA_ARGS__);                       \
+    if (LOG_MODULE_LEVEL >= (level)) {                                         \
+      static const char _log_entry[] LOG_FMT_SECTION =                         \
+          LOG_STR(level) LOG_TOKEN_SEP TAG LOG_TOKEN_SEP fmt;                  \
+      if (0) {                                                                 \
+        log_check_format(fmt, ##__VA_ARGS__);                                  \
+      }                                                                        \
+      log_write_token((level), TAG, _log_entry, ##__VA_ARGS__);                \
+    }                                                                          \
   } while (0)
 
-#define LOG_DEBUG_HEX(prefix, data, len)                                       \
+// conv: "B" (LOG_DEBUG_RAW) 또는 "H" (LOG_DEBUG_HEX)
+#define LOG_PRINT_DATA(level, prefix, data, len, conv)                         \
+  do {                                                                         \
+    if (LOG_MODULE_LEVEL >= (level)) {                                         \
+      static const char _log_entry[] LOG_FMT_SECTION =                         \
+          LOG_STR(level) LOG_TOKEN_SEP TAG LOG_TOKEN_SEP "%s[%u]%" conv;       \
+      log_write_token_data((level), TAG, _log_entry, prefix, data, len);       \
+    }                                                                          \
+  } while (0)
+#else
+#define LOG_PRINT(level, fmt, ...)                                             \
   do {                                                                         \
-    printf(COLOR_GREEN "[%u][D][%s]%s[%u]:", (unsigned)HAL_GetTick(), TAG,     \
-           prefix, (unsigned)len);                                             \
-    for (size_t i = 0; i < (len); i++) {                                       \
-      printf(" %02X", ((uint8_t *)(data))[i]);                                 \
+    if (LOG_MODULE_LEVEL >= (level)) {                                         \
+      log_write((level), TAG, fmt, ##__VA_ARGS__);                             \
     }                                                                          \
-    printf(COLOR_RESET "\r\n");                                                \
   } while (0)
 
-#define LOG_DEBUG_RAW(prefix, data, len)                           \
-   do                                                              \
-   {                                                               \
-      printf(COLOR_GREEN "[%u][D][%s]%s[%u]", (unsigned)HAL_GetTick(), TAG, prefix, (unsigned)len); \
-      for(size_t i = 0; i < (len); i++)                           \
-      {                                                            \
-         uint8_t c = ((uint8_t*)(data))[i];                       \
-         if(c == '\r') { printf("\r"); continue; }                      \
-         else if(c == '\n') { printf("\n"); continue; }                  \
-         else if(c >= 0x20 && c < 0x7F)                                \
-            printf("%c", c);                                      \
-         else                                                      \
-            printf("<%02X>", c);                                   \
-      }                                                            \
-      printf(COLOR_RESET "\r\n");                                  \
-   }while(0)
+#define LOG_PRINT_DATA(level, prefix, data, len, conv)                         \
+  do {                                                                         \
+    if (LOG_MODULE_LEVEL >= (level)) {                                         \
+      log_write_data((level), TAG, prefix, data, len, conv[0] == 'H');         \
+    }                                                                          \
+  } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...) LOG_PRINT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+
+#define LOG_DEBUG_HEX(prefix, data, len)                                       \
+  LOG_PRINT_DATA(LOG_LEVEL_DEBUG, prefix, data, len, "H")
+
+#define LOG_DEBUG_RAW(prefix, data, len)                                       \
+  LOG_PRINT_DATA(LOG_LEVEL_DEBUG, prefix, data, len, "B")
 
 #else
 #define LOG_DEBUG(fmt, ...)
@@ -65,34 +229,19 @@ typedef enum {
 #endif
 
 #if LOG_LEVEL >= LOG_LEVEL_INFO
-#define LOG_INFO(fmt, ...)                                                     \
-  do {                                                                         \
-    printf("[%u][I][%s]" fmt "\r\n", (unsigned)HAL_GetTick(), TAG,             \
-           ##__VA_ARGS__);                                                     \
-  } while (0)
-
+#define LOG_INFO(fmt, ...) LOG_PRINT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
 #else
 #define LOG_INFO(fmt, ...)
 #endif
 
 #if LOG_LEVEL >= LOG_LEVEL_WARNING
-#define LOG_WARN(fmt, ...)                                                     \
-  do {                                                                         \
-    printf(COLOR_YELLOW "[%u][W][%s]" fmt COLOR_RESET "\r\n",                  \
-           (unsigned)HAL_GetTick(), TAG, ##__VA_ARGS__);                       \
-  } while (0)
-
+#define LOG_WARN(fmt, ...) LOG_PRINT(LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)
 #else
 #define LOG_WARN(fmt, ...)
 #endif
 
 #if LOG_LEVEL >= LOG_LEVEL_ERROR
-#define LOG_ERR(fmt, ...)                                                      \
-  do {                                                                         \
-    printf(COLOR_RED "[%u][E][%s]" fmt COLOR_RESET "\r\n",                     \
-           (unsigned)HAL_GetTick(), TAG, ##__VA_ARGS__);                       \
-  } while (0)
-
+#define LOG_ERR(fmt, ...) LOG_PRINT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
 #else
 #define LOG_ERR(fmt, ...)
 #endif
@@ -124,22 +124,19 @@ void gps_evt_handler(gps_t* gps, gps_event_t event, gps_procotol_t protocol, gps
 
     // RTCM 패킷 처리
     if (protocol == GPS_PROTOCOL_RTCM && event == GPS_EVENT_RTCM_PACKET) {
-        const uint8_t *rtcm_data = NULL;
-        uint16_t rtcm_len = 0;
+        // RTCM 파서에서 프레임 가져오기 (복사 없음)
+        rtcm_frame_t *frame = rtcm_get_frame(&gps->rtcm);
 
-        // RTCM 파서에서 패킷 가져오기
-        rtcm_get_packet(&gps->rtcm, &rtcm_data, &rtcm_len);
-
-        if (rtcm_data) {
-            // ✅ LoRa 큐에 추가 (자동으로 메시지큐 신호 전송)
-            if (!lora_queue_enqueue_rtcm(&g_lora_queue, rtcm_data, rtcm_len)) {
+        if (frame) {
+            // ✅ LoRa 큐에 추가 (프레임 참조만 저장, 자동으로 메시지큐 신호 전송)
+            if (!lora_queue_enqueue_rtcm_frame(&g_lora_queue, frame)) {
                 // 큐가 가득 참! 패킷 드롭 경고
                 LOG_WARN("❌ LoRa 큐 풀! RTCM 패킷 드롭 (타입: %d, 사용률: %d%%)",
-                         rtcm_get_message_type(rtcm_data),
+                         frame->message_type,
                          lora_queue_get_usage_percent(&g_lora_queue));
             } else {
                 LOG_DEBUG("RTCM→LoRa 큐: %d bytes, 타입=%d, 큐=%d/%d",
-                         rtcm_len, rtcm_get_message_type(rtcm_data),
+                         frame->length, frame->message_type,
                          lora_queue_get_count(&g_lora_queue), LORA_QUEUE_SIZE);
             }
         }
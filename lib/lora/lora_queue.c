@@ -30,7 +30,35 @@ static uint8_t calculate_chunks(uint16_t packet_length) {
  * @brief RTCM 패킷을 큐에 추가
  */
 bool lora_queue_enqueue_rtcm(lora_queue_t *queue, const uint8_t *rtcm_data, uint16_t length) {
-    if (!queue || !rtcm_data || length == 0 || length > 1029) {
+    if (!queue || !rtcm_data || length == 0 || length > RTCM3_MAX_PACKET_SIZE) {
+        return false;
+    }
+
+    rtcm_frame_t *frame = rtcm_frame_alloc();
+    if (!frame) {
+        queue->stats.total_enqueued++;
+        queue->dropped_count++;
+        queue->stats.total_dropped++;
+        return false;
+    }
+
+    memcpy(frame->data, rtcm_data, length);
+    frame->length = length;
+    frame->message_type = rtcm_get_message_type(rtcm_data);
+
+    bool ret = lora_queue_enqueue_rtcm_frame(queue, frame);
+
+    // 큐가 참조를 잡았으므로 할당 참조는 해제
+    rtcm_frame_unref(frame);
+
+    return ret;
+}
+
+/**
+ * @brief RTCM 프레임을 복사 없이 큐에 추가
+ */
+bool lora_queue_enqueue_rtcm_frame(lora_queue_t *queue, rtcm_frame_t *frame) {
+    if (!queue || !frame || frame->length == 0) {
         return false;
     }
 
@@ -44,14 +72,17 @@ bool lora_queue_enqueue_rtcm(lora_queue_t *queue, const uint8_t *rtcm_data, uint
         return false;
     }
 
-    // 새 패킷 추가
+    // 새 패킷 추가 (프레임 참조)
+    rtcm_frame_ref(frame);
+
     lora_packet_t *pkt = &queue->packets[queue->head];
     pkt->type = LORA_PACKET_TYPE_RTCM;
-    memcpy(pkt->data, rtcm_data, length);
-    pkt->length = length;
+    pkt->frame = frame;
+    pkt->data = frame->data;
+    pkt->length = frame->length;
     pkt->packet_id = queue->next_packet_id++;
     pkt->current_chunk = 0;
-    pkt->total_chunks = calculate_chunks(length);
+    pkt->total_chunks = calculate_chunks(frame->length);
     pkt->completed = false;
 
     // 큐 헤드 이동
@@ -94,7 +125,9 @@ bool lora_queue_enqueue_status(lora_queue_t *queue, const lora_gps_status_t *sta
     // 새 패킷 추가
     lora_packet_t *pkt = &queue->packets[queue->head];
     pkt->type = LORA_PACKET_TYPE_STATUS;
-    memcpy(pkt->data, status, sizeof(lora_gps_status_t));
+    pkt->frame = NULL;
+    memcpy(&pkt->status, status, sizeof(lora_gps_status_t));
+    pkt->data = (const uint8_t *)&pkt->status;
     pkt->length = sizeof(lora_gps_status_t);
     pkt->packet_id = queue->next_packet_id++;
     pkt->current_chunk = 0;
@@ -152,7 +185,7 @@ bool lora_queue_get_next_chunk(lora_queue_t *queue, lora_chunk_t *chunk) {
     chunk->payload_len = (remaining > LORA_CHUNK_PAYLOAD_SIZE) ?
                          LORA_CHUNK_PAYLOAD_SIZE : remaining;
 
-    memcpy(chunk->payload, &pkt->data[offset], chunk->payload_len);
+    chunk->payload = &pkt->data[offset];
 
     // 다음 청크로 이동
     pkt->current_chunk++;
@@ -174,6 +207,14 @@ void lora_queue_dequeue(lora_queue_t *queue) {
     // 통계: 전송 완료 횟수
     queue->stats.total_transmitted++;
 
+    // RTCM 프레임 참조 해제
+    lora_packet_t *pkt = &queue->packets[queue->tail];
+    if (pkt->frame) {
+        rtcm_frame_unref(pkt->frame);
+        pkt->frame = NULL;
+    }
+    pkt->data = NULL;
+
     // 큐 테일 이동
     queue->tail = (queue->tail + 1) % LORA_QUEUE_SIZE;
     queue->count--;
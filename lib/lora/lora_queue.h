@@ -6,6 +6,7 @@
 #include <stddef.h>
 #include "FreeRTOS.h"
 #include "queue.h"
+#include "rtcm.h"
 
 // LoRa 전송 청크 설정
 // 240바이트까지 전송 가능한 경우 아래 값을 240으로 변경
@@ -14,11 +15,10 @@
 #define LORA_CHUNK_PAYLOAD_SIZE (LORA_MAX_CHUNK_SIZE - LORA_CHUNK_HEADER_SIZE)
 
 // LoRa 큐 크기 설정
-// 메모리 제약: 각 패킷 최대 1029 bytes
-// - 10개: 약 10KB RAM
-// - 20개: 약 20KB RAM (권장: 일반적인 경우)
-// - 30개: 약 30KB RAM (권장: LoRa 속도가 매우 느린 경우, SF11-12)
-#define LORA_QUEUE_SIZE 20             // 큐에 저장 가능한 최대 RTCM 패킷 수
+// RTCM 데이터는 큐에 복사하지 않고 RTCM 프레임 풀(rtcm.h)의 프레임을 참조한다.
+// 큐 항목은 수십 바이트이고, 실제로 버퍼링 가능한 RTCM 패킷 수는
+// RTCM_FRAME_POOL_SIZE 에 의해 제한된다 (프레임당 약 1KB).
+#define LORA_QUEUE_SIZE 20             // 큐에 저장 가능한 최대 패킷 수
 
 // Overflow 경고 임계값 (큐 사용률 %)
 #define LORA_QUEUE_WARNING_THRESHOLD 80  // 80% 이상 사용 시 경고
@@ -39,9 +39,10 @@ typedef struct __attribute__((packed)) {
 } lora_chunk_header_t;
 
 // LoRa 청크 (헤더 + 페이로드)
+// payload 는 큐에 있는 패킷 데이터를 가리키며 다음 lora_queue_get_next_chunk() 호출 전까지 유효
 typedef struct {
     lora_chunk_header_t header;
-    uint8_t payload[LORA_CHUNK_PAYLOAD_SIZE];
+    const uint8_t *payload;
     uint8_t payload_len;    // 실제 페이로드 길이
 } lora_chunk_t;
 
@@ -58,7 +59,9 @@ typedef struct __attribute__((packed)) {
 // LoRa 패킷 큐 항목
 typedef struct {
     lora_packet_type_t type;  // 패킷 타입
-    uint8_t data[1029];       // 패킷 데이터 (RTCM 또는 STATUS)
+    const uint8_t *data;      // 패킷 데이터 (RTCM: frame->data, STATUS: status)
+    rtcm_frame_t *frame;      // 참조 중인 RTCM 프레임 (STATUS 는 NULL)
+    lora_gps_status_t status; // STATUS 패킷 데이터
     uint16_t length;          // 실제 패킷 길이
     uint8_t packet_id;        // 패킷 ID
     uint8_t current_chunk;    // 현재 전송 중인 청크 인덱스
@@ -96,13 +99,28 @@ void lora_queue_init(lora_queue_t *queue, QueueHandle_t notify_queue);
 
 /**
  * @brief RTCM 패킷을 큐에 추가
+ *
+ * 프레임 풀에 한번 복사한다. GPS 파서에서 받은 프레임은
+ * lora_queue_enqueue_rtcm_frame()을 사용하면 복사 없이 추가된다.
+ *
  * @param queue 큐 구조체 포인터
  * @param rtcm_data RTCM 패킷 데이터
  * @param length 패킷 길이
- * @return true: 성공, false: 큐 풀
+ * @return true: 성공, false: 큐 풀 또는 프레임 풀 부족
  */
 bool lora_queue_enqueue_rtcm(lora_queue_t *queue, const uint8_t *rtcm_data, uint16_t length);
 
+/**
+ * @brief RTCM 프레임을 복사 없이 큐에 추가
+ *
+ * 프레임 참조를 잡고, 전송 완료 후 lora_queue_dequeue()에서 해제한다.
+ *
+ * @param queue 큐 구조체 포인터
+ * @param frame RTCM 프레임 (rtcm_get_frame)
+ * @return true: 성공, false: 큐 풀
+ */
+bool lora_queue_enqueue_rtcm_frame(lora_queue_t *queue, rtcm_frame_t *frame);
+
 /**
  * @brief GPS 상태 패킷을 큐에 추가
  * @param queue 큐 구조체 포인터
@@ -15,22 +15,21 @@ static void send_gps_status_to_lora(gps_t *gps) {
     if (!gps) return;
 
     lora_gps_status_t status;
+    gps_nav_t nav;
 
-    // GPS fix 상태 채우기
-    xSemaphoreTake(gps->mutex, portMAX_DELAY);
+    // 최신 항법해 스냅샷 (파서를 기다리지 않음)
+    if (!gps_get_nav(gps, &nav) || nav.sol.epoch == 0) return;
 
-    status.fix_type = gps->nmea_data.gga.fix;  // GPS fix 타입
-    status.num_satellites = gps->nmea_data.gga.sats;  // 위성 개수
+    status.fix_type = nav.sol.fix;  // GPS fix 타입
+    status.num_satellites = nav.sol.sats;  // 위성 개수
 
     // HDOP (100배 스케일)
-    status.hdop = (uint16_t)(gps->nmea_data.gga.hdop * 100);
+    status.hdop = (uint16_t)(nav.sol.hdop * 100);
 
-    // 위도/경도/고도 (정수 변환)
-    status.latitude = (int32_t)(gps->nmea_data.gga.lat * 1e7);
-    status.longitude = (int32_t)(gps->nmea_data.gga.lon * 1e7);
-    status.altitude = (int32_t)(gps->nmea_data.gga.alt * 1000);
-
-    xSemaphoreGive(gps->mutex);
+    // 위도/경도/고도 (정수 변환, 출처는 NMEA/UBX 중 더 정밀한 쪽)
+    status.latitude = (int32_t)(nav.sol.lat * 1e7);
+    status.longitude = (int32_t)(nav.sol.lon * 1e7);
+    status.altitude = (int32_t)(nav.sol.msl * 1000);
 
     // LoRa 큐에 추가
     if (!lora_queue_enqueue_status(&g_lora_queue, &status)) {
@@ -38,7 +37,7 @@ static void send_gps_status_to_lora(gps_t *gps) {
     } else {
         LOG_DEBUG("GPS 상태 전송: fix=%d, sats=%d, lat=%.7f, lon=%.7f",
                  status.fix_type, status.num_satellites,
-                 gps->nmea_data.gga.lat, gps->nmea_data.gga.lon);
+                 nav.sol.lat, nav.sol.lon);
     }
 }
 
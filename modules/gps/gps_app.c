@@ -1,17 +1,16 @@
 #include "gps_app.h"
 #include "gps.h"
+#include "gps_avg.h"
+#include "gps_rtcm_filter.h"
+#include "rtcm_msm.h"
 #include "gps_port.h"
+#include "gps_config.h"
 #include "led.h"
 #include <string.h>
 #include "board_config.h"
 #include "ntrip_app.h"
 #include "tcp_socket.h"
 
-#define GPS_UART_MAX_RECV_SIZE 2048
-
-#define GGA_AVG_SIZE 50
-#define HP_AVG_SIZE 50
-
 typedef struct {
   const char* cmd;
 } gps_init_cmd_t;
@@ -41,6 +40,7 @@ static const gps_init_cmd_t um982_base_cmds[] = {
   {"CONFIG RESET\r\n"},
   {"MODE BASE TIME 60 1.5 2.5\r\n"},
   {"GNGGA 1\r\n"},
+  {"BESTNAVB 1\r\n"},
   {"SAVECONFIG\r\n"},
 };
 
@@ -52,30 +52,37 @@ static const gps_init_cmd_t um982_rover_cmds[] = {
   {"SAVECONFIG\r\n"},
 };
 
+/**
+ * @brief UART 보레이트 협상 상태
+ */
+typedef enum {
+  GPS_BAUD_WAIT_BOOT = 0,  // 부팅 보레이트로 첫 프레임 대기
+  GPS_BAUD_VERIFY,         // 목표 보레이트 전환 후 프레임 확인
+  GPS_BAUD_PROBE,          // 응답이 없어 알려진 보레이트 탐색
+  GPS_BAUD_DONE
+} gps_baud_state_t;
+
+static const uint32_t gps_baud_probe_list[] = GPS_UART_PROBE_BAUDS;
+#define GPS_BAUD_PROBE_CNT (sizeof(gps_baud_probe_list) / sizeof(gps_baud_probe_list[0]))
+
+/* 이동 평균 채널 */
+enum {
+  GPS_AVG_LAT = 0,
+  GPS_AVG_LON,
+  GPS_AVG_ALT,
+  GPS_AVG_MSL,
+};
+
 typedef struct
 {
-	int32_t lon[HP_AVG_SIZE];
-	int32_t lat[HP_AVG_SIZE];
-	int32_t height[HP_AVG_SIZE];
-	int32_t msl[HP_AVG_SIZE];
-	int8_t lon_hp[HP_AVG_SIZE];
-	int8_t lat_hp[HP_AVG_SIZE];
-	int8_t height_hp[HP_AVG_SIZE];
-	int8_t msl_hp[HP_AVG_SIZE];
-	uint32_t hacc;
-	uint32_t vacc;
-  double lon_avg;
-  double lat_avg;
-  double height_avg;
-  double msl_avg;
-  uint8_t pos;
-  uint8_t len;
+  gps_avg_t avg;  // 위도/경도 [1e-7 deg], 타원체고/해발고 [mm]
+  uint32_t hacc;
+  uint32_t vacc;
   bool can_read;
 }ubx_hp_avg_data_t;
 
 typedef struct {
   gps_t gps;
-  QueueHandle_t queue;
   TaskHandle_t task;
   gps_type_t type;
   gps_id_t id;
@@ -83,15 +90,17 @@ typedef struct {
 
   ubx_hp_avg_data_t ubx_hp_avg;
 
+  gps_survey_t survey;  // 베이스 좌표 측량
+
+  // 베이스 RTCM 출력 (필터 통과분만 소비자에 전달)
+  gps_rtcm_filter_t rtcm_filter;
+  struct {
+    gps_rtcm_out_cb_t cb;
+    void* arg;
+  } rtcm_out;
+
   struct {
-    double lat[GGA_AVG_SIZE];
-    double lon[GGA_AVG_SIZE];
-    double alt[GGA_AVG_SIZE];
-    double lat_avg;
-    double lon_avg;
-    double alt_avg;
-    uint8_t pos;
-    uint8_t len;
+    gps_avg_t avg;  // 위도/경도 [deg], 고도 [m]
     bool can_read;
   } gga_avg_data;
 
@@ -101,6 +110,25 @@ typedef struct {
     bool need_send_config;
   } config;
 
+  // UART 보레이트 협상
+  struct {
+    gps_baud_state_t state;
+    uint32_t cur;            // 현재 USART 보레이트
+    uint32_t valid_frames;   // 체크섬을 통과한 프레임 수
+    uint32_t mark;           // 확인 시작 시점의 valid_frames
+    TickType_t deadline;
+    TickType_t last_frame;   // 마지막 정상 프레임 수신 시각
+    uint8_t probe_idx;
+    uint8_t retry;
+  } baud;
+
+  // DMA 수신 통계
+  struct {
+    uint32_t rx_bytes;     // 파서에 전달한 바이트
+    uint32_t lost_bytes;   // DMA가 읽기 위치를 앞질러 버린 바이트
+    uint32_t overrun_cnt;  // 앞지름 발생 횟수
+  } rx_stats;
+
   // 명령 응답 대기용
   struct {
     SemaphoreHandle_t done_sem;
@@ -113,6 +141,9 @@ typedef struct {
 
 static gps_instance_t gps_instances[GPS_ID_MAX] = {0};
 
+static const gps_rtcm_rule_t gps_rtcm_rules[] = GPS_RTCM_FILTER_RULES;
+#define GPS_RTCM_RULE_CNT (sizeof(gps_rtcm_rules) / sizeof(gps_rtcm_rules[0]))
+
 // GPS 명령 큐 및 태스크
 static QueueHandle_t gps_cmd_queue = NULL;
 static TaskHandle_t gps_cmd_task_handle = NULL;
@@ -146,127 +177,192 @@ static const gps_init_sequence_t* get_init_sequence(board_type_t board) {
 
 void _add_gga_avg_data(gps_instance_t* inst, double lat, double lon, double alt)
 {
-  uint8_t pos = inst->gga_avg_data.pos;
-  double lat_temp = 0.0, lon_temp = 0.0, alt_temp = 0.0;
+  const double val[] = {lat, lon, alt};
+
+  gps_avg_add(&inst->gga_avg_data.avg, val);
+
+  if(gps_avg_is_full(&inst->gga_avg_data.avg))
+  {
+    inst->gga_avg_data.can_read = true;
+  }
+}
 
-  double prev_lat = inst->gga_avg_data.lat[pos];
-  double prev_lon = inst->gga_avg_data.lon[pos];
-  double prev_alt = inst->gga_avg_data.alt[pos];
+void _add_hp_avg_data(gps_instance_t* inst)
+{
+  gps_ubx_nav_hpposllh_t* data = &inst->gps.ubx_data.hpposllh;
+  ubx_hp_avg_data_t* avg_data = &inst->ubx_hp_avg;
 
-  inst->gga_avg_data.lat[pos] = lat;
-  inst->gga_avg_data.lon[pos] = lon;
-  inst->gga_avg_data.alt[pos] = alt;
+  // hp 필드는 위도/경도 1e-9 deg, 고도 0.1 mm 단위
+  const double val[] = {
+    data->lat + data->lat_hp / 100.0,
+    data->lon + data->lon_hp / 100.0,
+    data->height + data->height_hp / 10.0,
+    data->msl + data->msl_hp / 10.0,
+  };
 
-  inst->gga_avg_data.pos = (inst->gga_avg_data.pos + 1) % GGA_AVG_SIZE;
+  gps_avg_add(&avg_data->avg, val);
+  avg_data->hacc = data->hacc;
+  avg_data->vacc = data->vacc;
 
-  /* 정확도를 중시한 코드 */
-  if(inst->gga_avg_data.len < GGA_AVG_SIZE)
+  if(gps_avg_is_full(&avg_data->avg))
   {
-    inst->gga_avg_data.len++;
+    avg_data->can_read = true;
+  }
+}
 
-    if(inst->gga_avg_data.len == GGA_AVG_SIZE)
-    {
-      
-      for(int i = 0; i < GGA_AVG_SIZE; i++)
-      {
-        lat_temp += inst->gga_avg_data.lat[i];
-        lon_temp += inst->gga_avg_data.lon[i];
-        alt_temp += inst->gga_avg_data.alt[i];
-      }
+/**
+ * @brief 고정소수점 문자열 변환 (printf 부동소수점 미지원 대비)
+ *
+ * @param buf 출력 버퍼
+ * @param size 버퍼 크기
+ * @param val 값
+ * @param decimals 소수점 아래 자리수 (최대 9)
+ */
+static void _fmt_fixed(char* buf, size_t size, double val, uint8_t decimals)
+{
+  uint32_t scale = 1;
+  bool neg = (val < 0.0);
+
+  for (uint8_t i = 0; i < decimals; i++) {
+    scale *= 10;
+  }
+
+  if (neg) {
+    val = -val;
+  }
+
+  uint32_t ip = (uint32_t)val;
+  uint32_t fp = (uint32_t)((val - ip) * scale + 0.5);
+
+  if (fp >= scale) {
+    ip++;
+    fp -= scale;
+  }
+
+  snprintf(buf, size, "%s%lu.%0*lu", neg ? "-" : "", (unsigned long)ip,
+           (int)decimals, (unsigned long)fp);
+}
 
-      inst->gga_avg_data.lat_avg = lat_temp / (double)GGA_AVG_SIZE;
-      inst->gga_avg_data.lon_avg = lon_temp / (double)GGA_AVG_SIZE;
-      inst->gga_avg_data.alt_avg = alt_temp / (double)GGA_AVG_SIZE;
+/**
+ * @brief 측량 결과로 수신기를 고정 좌표 베이스 모드로 전환
+ *
+ * 이벤트 핸들러 안에서 호출되므로 send_async로 보내고 기다리지 않는다.
+ * F9P: CFG-VALSET TMODE (ECEF, RAM 레이어), UM982: MODE BASE lat lon hgt
+ *
+ * @param inst GPS 인스턴스
+ */
+static void gps_survey_apply_fixed(gps_instance_t* inst)
+{
+  gps_survey_result_t res;
+  uint8_t cmd[96];
+  size_t len = 0;
 
-      inst->gga_avg_data.can_read = true;
+  if (!inst->gps.ops || !gps_survey_get_result(&inst->survey, &res)) {
+    return;
+  }
+
+  if (inst->type == GPS_TYPE_F9P) {
+    int64_t ecef[3];
+    int32_t cm[3];
+    int8_t hp[3];
+
+    gps_survey_get_ecef(&inst->survey, ecef);
+    for (int i = 0; i < 3; i++) {
+      cm[i] = (int32_t)(ecef[i] / 100);
+      hp[i] = (int8_t)(ecef[i] - (int64_t)cm[i] * 100);
     }
+
+    const gps_ubx_cfg_kv_t kv[] = {
+      {GPS_UBX_CFG_KEY_TMODE_MODE, GPS_UBX_TMODE_FIXED},
+      {GPS_UBX_CFG_KEY_TMODE_POS_TYPE, 0},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_X, (uint32_t)cm[0]},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_Y, (uint32_t)cm[1]},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_Z, (uint32_t)cm[2]},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_X_HP, (uint8_t)hp[0]},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_Y_HP, (uint8_t)hp[1]},
+      {GPS_UBX_CFG_KEY_TMODE_ECEF_Z_HP, (uint8_t)hp[2]},
+      {GPS_UBX_CFG_KEY_TMODE_FIXED_POS_ACC,
+       (uint32_t)(res.mean_acc * GPS_SURVEY_ECEF_SCALE + 0.5)},
+    };
+
+    len = gps_ubx_make_cfg_valset(cmd, sizeof(cmd), GPS_UBX_CFG_LAYER_RAM,
+                                  kv, sizeof(kv) / sizeof(kv[0]));
+  } else if (inst->type == GPS_TYPE_UM982) {
+    char lat[24], lon[24], hgt[24];
+
+    _fmt_fixed(lat, sizeof(lat), res.lat, 9);
+    _fmt_fixed(lon, sizeof(lon), res.lon, 9);
+    _fmt_fixed(hgt, sizeof(hgt), res.height, 4);
+    len = snprintf((char*)cmd, sizeof(cmd), "MODE BASE %s %s %s\r\n", lat,
+                   lon, hgt);
+  }
+
+  if (len == 0 || len >= sizeof(cmd)) {
+    LOG_ERR("GPS[%d] Survey fixed mode command build failed", inst->id);
+    return;
   }
-  else
-  {
-      for(int i = 0; i < GGA_AVG_SIZE; i++)
-      {
-        lat_temp += inst->gga_avg_data.lat[i];
-        lon_temp += inst->gga_avg_data.lon[i];
-        alt_temp += inst->gga_avg_data.alt[i];
-      }
 
-      inst->gga_avg_data.lat_avg = lat_temp / (double)GGA_AVG_SIZE;
-      inst->gga_avg_data.lon_avg = lon_temp / (double)GGA_AVG_SIZE;
-      inst->gga_avg_data.alt_avg = alt_temp / (double)GGA_AVG_SIZE;
+  if (inst->gps.ops->send_async) {
+    inst->gps.ops->send_async((const char*)cmd, len);
+  } else if (inst->gps.ops->send) {
+    inst->gps.ops->send((const char*)cmd, len);
   }
 }
 
-void _add_hp_avg_data(gps_instance_t* inst)
+/**
+ * @brief 측량 완료 처리
+ *
+ * @param inst GPS 인스턴스
+ */
+static void gps_survey_on_done(gps_instance_t* inst)
 {
-  gps_t* gps = &inst->gps;
-  uint8_t pos = inst->ubx_hp_avg.pos;
-  gps_ubx_nav_hpposllh_t* data = &gps->ubx_data.hpposllh;
-  ubx_hp_avg_data_t* avg_data = &inst->ubx_hp_avg;
+  gps_survey_result_t res;
 
-  int64_t lat_sum=0, lon_sum=0, height_sum=0, msl_sum=0;
-  int16_t lat_hp_sum=0, lon_hp_sum=0, height_hp_sum=0, msl_hp_sum=0;
-
-  avg_data->lon[pos] = data->lon;
-  avg_data->lat[pos] = data->lat;
-  avg_data->height[pos] = data->height;
-  avg_data->msl[pos] = data->msl;
-  avg_data->lon_hp[pos] = data->lon_hp;
-  avg_data->lat_hp[pos] = data->lat_hp;
-  avg_data->height_hp[pos] = data->height_hp;
-  avg_data->msl_hp[pos] = data->msl_hp;
-  avg_data->hacc = data->hacc;
-  avg_data->vacc = data->vacc;
+  gps_survey_get_result(&inst->survey, &res);
+  LOG_INFO("GPS[%d] Survey done: %lu samples, acc %lu mm, 3D std %lu mm",
+           inst->id, (unsigned long)res.count,
+           (unsigned long)(res.mean_acc * 1000.0 + 0.5),
+           (unsigned long)(res.std_3d * 1000.0 + 0.5));
 
-  avg_data->pos = (avg_data->pos + 1) % HP_AVG_SIZE;
+#if GPS_SURVEY_APPLY_FIXED
+  gps_survey_apply_fixed(inst);
+#endif
+}
 
-  if(avg_data->len < HP_AVG_SIZE)
-  {
-    avg_data->len++;
+void _add_survey_hp_data(gps_instance_t* inst)
+{
+  gps_ubx_nav_hpposllh_t* data = &inst->gps.ubx_data.hpposllh;
 
-    if(avg_data->len == HP_AVG_SIZE)
-    {
-      for(int i = 0; i < HP_AVG_SIZE; i++)
-      {
-        lon_sum += avg_data->lon[i];
-        lat_sum += avg_data->lat[i];
-        height_sum += avg_data->height[i];
-        msl_sum += avg_data->msl[i];
-        lon_hp_sum += avg_data->lon_hp[i];
-        lat_hp_sum += avg_data->lat_hp[i];
-        height_hp_sum += avg_data->height_hp[i];
-        msl_hp_sum += avg_data->msl_hp[i];
-      }
+  if (inst->survey.state != GPS_SURVEY_RUNNING) {
+    return;
+  }
 
-      avg_data->lon_avg = (lon_sum / (double)HP_AVG_SIZE) + (lon_hp_sum / (double)HP_AVG_SIZE / (double)100);
-      avg_data->lat_avg = (lat_sum / (double)HP_AVG_SIZE) + (lat_hp_sum / (double)HP_AVG_SIZE / (double)100);
-      avg_data->height_avg = (height_sum / (double)HP_AVG_SIZE) + (height_hp_sum / (double)HP_AVG_SIZE / (double)10);
-      avg_data->msl_avg = (msl_sum / (double)HP_AVG_SIZE) + (msl_hp_sum / (double)HP_AVG_SIZE / (double)10);
+  double lat = (data->lat * 100.0 + data->lat_hp) * 1e-9;
+  double lon = (data->lon * 100.0 + data->lon_hp) * 1e-9;
+  double height = (data->height * 10.0 + data->height_hp) * 1e-4;
 
-      avg_data->can_read = true;
-    }
+  if (gps_survey_add_llh(&inst->survey, lat, lon, height)) {
+    gps_survey_on_done(inst);
   }
-  else if(avg_data->len == HP_AVG_SIZE)
-  {
-    for(int i = 0; i < HP_AVG_SIZE; i++)
-    {
-      lon_sum += avg_data->lon[i];
-      lat_sum += avg_data->lat[i];
-      height_sum += avg_data->height[i];
-      msl_sum += avg_data->msl[i];
-      lon_hp_sum += avg_data->lon_hp[i];
-      lat_hp_sum += avg_data->lat_hp[i];
-      height_hp_sum += avg_data->height_hp[i];
-      msl_hp_sum += avg_data->msl_hp[i];
-    }
+}
+
+/**
+ * @brief Unicore BESTNAV/ADRNAV 위치로 측량 진행
+ *
+ * 바이너리 위치는 double이라 NMEA보다 정밀하므로 HPPOSLLH 대신 사용한다.
+ *
+ * @param inst GPS 인스턴스
+ */
+static void _add_survey_sol_data(gps_instance_t* inst)
+{
+  const gps_solution_t* sol = &inst->gps.sol.out;
 
-    avg_data->lon_avg = (lon_sum / (double)HP_AVG_SIZE) + (lon_hp_sum / (double)HP_AVG_SIZE / (double)100);
-    avg_data->lat_avg = (lat_sum / (double)HP_AVG_SIZE) + (lat_hp_sum / (double)HP_AVG_SIZE / (double)100);
-    avg_data->height_avg = (height_sum / (double)HP_AVG_SIZE) + (height_hp_sum / (double)HP_AVG_SIZE / (double)10);
-    avg_data->msl_avg = (msl_sum / (double)HP_AVG_SIZE) + (msl_hp_sum / (double)HP_AVG_SIZE / (double)10);
+  if (inst->survey.state != GPS_SURVEY_RUNNING) {
+    return;
   }
-  else
-  {
-	  LOG_ERR("HP AVG LEN mismatch");
+
+  if (gps_survey_add_llh(&inst->survey, sol->lat, sol->lon, sol->height)) {
+    gps_survey_on_done(inst);
   }
 }
 
@@ -294,6 +390,194 @@ static void gps_send_config_commands(gps_instance_t* inst) {
   LOG_INFO("GPS[%d] All commands sent, init complete", inst->id);
 }
 
+/**
+ * @brief USART 보레이트 변경 후 확인 대기 시작
+ *
+ * @param inst GPS 인스턴스
+ * @param baud 보레이트
+ * @param next 다음 상태
+ */
+static void gps_baud_apply(gps_instance_t* inst, uint32_t baud, gps_baud_state_t next)
+{
+  gps_port_set_baud(&inst->gps, baud);
+
+  xSemaphoreTake(inst->gps.mutex, portMAX_DELAY);
+  gps_parse_reset(&inst->gps);
+  xSemaphoreGive(inst->gps.mutex);
+
+  inst->baud.cur = baud;
+  inst->baud.state = next;
+  inst->baud.mark = inst->baud.valid_frames;
+  inst->baud.deadline = xTaskGetTickCount() + pdMS_TO_TICKS(GPS_BAUD_VERIFY_MS);
+}
+
+/**
+ * @brief 수신기에 목표 보레이트 전환 명령 전송 후 USART 변경
+ *
+ * UM982: CONFIG COMx <baud>, F9P: UBX-CFG-VALSET CFG-UART1-BAUDRATE (RAM 레이어).
+ * 저장하지 않으므로 수신기 전원이 꺼지면 부팅 보레이트로 돌아간다.
+ *
+ * @param inst GPS 인스턴스
+ * @return true: USART 보레이트 변경됨
+ */
+static bool gps_baud_switch(gps_instance_t* inst)
+{
+  const uint32_t target = GPS_UART_TARGET_BAUD;
+  char cmd[32];
+  size_t len = 0;
+
+  if (inst->baud.cur == target || !inst->gps.ops || !inst->gps.ops->send) {
+    inst->baud.state = GPS_BAUD_DONE;
+    return false;
+  }
+
+  if (inst->type == GPS_TYPE_UM982) {
+    len = snprintf(cmd, sizeof(cmd), "CONFIG %s %u\r\n", GPS_UM982_COM_PORT,
+                   (unsigned)target);
+  } else if (inst->type == GPS_TYPE_F9P) {
+    len = gps_ubx_make_cfg_valset_u4((uint8_t*)cmd, sizeof(cmd),
+                                     GPS_UBX_CFG_LAYER_RAM,
+                                     GPS_UBX_CFG_KEY_UART1_BAUDRATE, target);
+  }
+
+  if (len == 0 || len >= sizeof(cmd)) {
+    inst->baud.state = GPS_BAUD_DONE;
+    return false;
+  }
+
+  LOG_INFO("GPS[%d] Baud %u -> %u", inst->id, (unsigned)inst->baud.cur,
+           (unsigned)target);
+
+  // send는 마지막 바이트가 나갈 때까지 블로킹
+  inst->gps.ops->send(cmd, len);
+  vTaskDelay(pdMS_TO_TICKS(GPS_BAUD_SWITCH_DELAY_MS));
+
+  gps_baud_apply(inst, target, GPS_BAUD_VERIFY);
+  return true;
+}
+
+/**
+ * @brief 보레이트 협상 진행 (GPS 태스크에서 매 수신마다 호출)
+ *
+ * 프레임이 들어오면 목표 보레이트로 전환하고, 전환 후 정해진 시간 안에
+ * 체크섬을 통과한 프레임이 없으면 알려진 보레이트를 하나씩 시도한다.
+ * 확정 후에도 GPS_BAUD_LOST_MS 동안 프레임이 없으면 (수신기 리셋 등)
+ * 다시 탐색한다.
+ *
+ * @param inst GPS 인스턴스
+ * @return true: USART 보레이트가 바뀜 (이전 보레이트로 받은 바이트는 버려야 함)
+ */
+static bool gps_baud_process(gps_instance_t* inst)
+{
+  bool got_frame = (inst->baud.valid_frames != inst->baud.mark);
+  bool expired = (int32_t)(xTaskGetTickCount() - inst->baud.deadline) >= 0;
+
+  switch (inst->baud.state) {
+    case GPS_BAUD_WAIT_BOOT:
+      // UM982는 설정 명령 전송(init 완료) 후, F9P는 첫 프레임 수신 후 전환
+      if (got_frame && (inst->gps.init_state == GPS_INIT_DONE || expired)) {
+        return gps_baud_switch(inst);
+      }
+
+      if (expired) {
+        LOG_WARN("GPS[%d] No frame at %u, probing", inst->id,
+                 (unsigned)inst->baud.cur);
+        inst->baud.probe_idx = 0;
+        gps_baud_apply(inst, gps_baud_probe_list[0], GPS_BAUD_PROBE);
+        return true;
+      }
+      break;
+
+    case GPS_BAUD_VERIFY:
+      if (got_frame) {
+        LOG_INFO("GPS[%d] Baud %u OK", inst->id, (unsigned)inst->baud.cur);
+        inst->baud.state = GPS_BAUD_DONE;
+      } else if (expired) {
+        LOG_WARN("GPS[%d] No frame at %u, probing", inst->id,
+                 (unsigned)inst->baud.cur);
+        inst->baud.probe_idx = 0;
+        gps_baud_apply(inst, gps_baud_probe_list[0], GPS_BAUD_PROBE);
+        return true;
+      }
+      break;
+
+    case GPS_BAUD_PROBE:
+      if (got_frame) {
+        LOG_INFO("GPS[%d] Receiver found at %u", inst->id,
+                 (unsigned)inst->baud.cur);
+
+        if (inst->baud.cur != GPS_UART_TARGET_BAUD &&
+            inst->baud.retry < GPS_BAUD_MAX_RETRY) {
+          inst->baud.retry++;
+          return gps_baud_switch(inst);
+        }
+
+        inst->baud.state = GPS_BAUD_DONE;
+      } else if (expired) {
+        inst->baud.probe_idx = (inst->baud.probe_idx + 1) % GPS_BAUD_PROBE_CNT;
+        gps_baud_apply(inst, gps_baud_probe_list[inst->baud.probe_idx],
+                       GPS_BAUD_PROBE);
+        return true;
+      }
+      break;
+
+    case GPS_BAUD_DONE:
+      // 부팅 보레이트로 동작 중이면 리셋되어도 보레이트는 그대로
+      if (inst->baud.cur != GPS_UART_BOOT_BAUD &&
+          (xTaskGetTickCount() - inst->baud.last_frame) >=
+              pdMS_TO_TICKS(GPS_BAUD_LOST_MS)) {
+        LOG_WARN("GPS[%d] No frame for %u ms at %u, probing", inst->id,
+                 (unsigned)GPS_BAUD_LOST_MS, (unsigned)inst->baud.cur);
+        inst->baud.retry = 0;
+        inst->baud.probe_idx = 0;
+        gps_baud_apply(inst, gps_baud_probe_list[0], GPS_BAUD_PROBE);
+        return true;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return false;
+}
+
+/**
+ * @brief 완성된 RTCM 프레임을 필터에 통과시켜 출력 소비자에 전달
+ *
+ * 프레임은 복사하지 않는다. 소비자가 핸들러 밖에서 쓰려면 rtcm_frame_ref()로
+ * 참조를 잡아야 한다 (lora_queue_enqueue_rtcm_frame 등).
+ */
+static void _forward_rtcm(gps_instance_t* inst)
+{
+  rtcm_frame_t* frame = rtcm_get_frame(&inst->gps.rtcm);
+  rtcm_frame_t* msm4 = NULL;
+  bool pass = true;
+
+  // 소비자가 없으면 변환/필터를 돌릴 필요가 없음 (프레임 풀도 쓰지 않음)
+  if (!frame || !inst->rtcm_out.cb) return;
+
+#if GPS_RTCM_MSM7_TO_MSM4
+  // MSM7은 MSM4로 줄여서 내보냄 (풀이 비었으면 원본 그대로)
+  msm4 = rtcm_msm7_to_msm4_frame(frame);
+  if (msm4) {
+    frame = msm4;
+  }
+#endif
+
+#if GPS_RTCM_FILTER_ENABLE
+  pass = gps_rtcm_filter_check(&inst->rtcm_filter, frame->data, frame->length,
+                               xTaskGetTickCount() * portTICK_PERIOD_MS);
+#endif
+
+  if (pass) {
+    inst->rtcm_out.cb(inst->id, frame, inst->rtcm_out.arg);
+  }
+
+  if (msm4) {
+    rtcm_frame_unref(msm4);
+  }
+}
 
 void gps_evt_handler(gps_t* gps, gps_event_t event, gps_procotol_t protocol, gps_msg_t msg)
 {
@@ -307,8 +591,33 @@ void gps_evt_handler(gps_t* gps, gps_event_t event, gps_procotol_t protocol, gps
 
   if (!inst) return;
 
+  // 핸들러는 체크섬/CRC를 통과한 프레임에서만 호출됨 (항법해 이벤트 제외)
+  if (event != GPS_EVENT_SOLUTION) {
+    inst->baud.valid_frames++;
+    inst->baud.last_frame = xTaskGetTickCount();
+  }
+
   switch(event)
   {
+     case GPS_EVENT_SOLUTION:
+      // 이번 에포크에 HPPOSLLH가 들어왔을 때만 고정밀 평균/측량에 반영
+      // (hpposllh는 내보내는 에포크의 값, bit0: invalidLlh)
+      if ((gps->sol.out.src_mask & (1u << GPS_SOL_SRC_UBX_HPPOSLLH)) &&
+          !(gps->ubx_data.hpposllh.flag & 0x01) &&
+          gps->sol.out.fix >= GPS_FIX_GPS)
+      {
+        _add_hp_avg_data(inst);
+        _add_survey_hp_data(inst);
+      }
+      else if ((gps->sol.out.src_mask &
+                ((1u << GPS_SOL_SRC_UNICORE_BESTNAV) |
+                 (1u << GPS_SOL_SRC_UNICORE_ADRNAV))) &&
+               gps->sol.out.fix >= GPS_FIX_GPS)
+      {
+        _add_survey_sol_data(inst);
+      }
+      return;
+
      case GPS_EVENT_READY:
       // RDY 수신 → 설정 명령 전송 플래그 설정
       if (inst->config.seq != NULL) {
@@ -354,36 +663,24 @@ void gps_evt_handler(gps_t* gps, gps_event_t event, gps_procotol_t protocol, gps
       {
         if(gps->nmea_data.gga.fix >= GPS_FIX_GPS)
         {
-          _add_gga_avg_data(inst, gps->nmea_data.gga.lat, gps->nmea_data.gga.lon, gps->nmea_data.gga.alt);
+          _add_gga_avg_data(inst, GPS_NMEA_NDEG_TO_DEG(gps->nmea_data.gga.lat),
+                            GPS_NMEA_NDEG_TO_DEG(gps->nmea_data.gga.lon),
+                            gps->nmea_data.gga.alt);
         }
 
-        // ✅ NTRIP 소켓으로 GGA 전송 (1초마다 자동)
-        tcp_socket_t* ntrip_sock = ntrip_get_socket();
-        if (ntrip_sock) {
-          char gga_buf[100];
-          uint8_t gga_len = 0;
-
-          if (get_gga(gps, gga_buf, &gga_len)) {
-            int send_ret = tcp_send(ntrip_sock, (const uint8_t*)gga_buf, gga_len);
-
-            if (send_ret > 0) {
-              LOG_DEBUG("GGA→NTRIP (%d bytes): %.*s", send_ret, gga_len - 2, gga_buf);
-            } else {
-              LOG_WARN("GGA 전송 실패: %d", send_ret);
-            }
-          }
+        // ✅ 최신 GGA를 NTRIP 업링크에 전달 (전송은 NTRIP 태스크가 담당)
+        // 핸들러는 파서 컨텍스트이므로 스냅샷 복사 없이 원본 버퍼를 직접 참조
+        if (gps->nmea_data.gga_is_rdy && gps->nmea_data.gga.fix != GPS_FIX_INVALID) {
+          ntrip_post_gga(gps->nmea_data.gga_raw, gps->nmea_data.gga_raw_pos);
         }
       }
       break;
 
-    case GPS_PROTOCOL_UBX:
-      if(msg.ubx.id == GPS_UBX_NAV_ID_HPPOSLLH)
-      {
-        if(gps->nmea_data.gga.fix >= GPS_FIX_GPS)
-        {
-          _add_hp_avg_data(inst);
-        }
+    case GPS_PROTOCOL_RTCM:
+      if (event == GPS_EVENT_RTCM_PACKET) {
+        _forward_rtcm(inst);
       }
+      break;
 
     default:
     	 break;
@@ -403,14 +700,22 @@ static void gps_process_task(void *pvParameter) {
   gps_id_t id = (gps_id_t)(uintptr_t)pvParameter;
   gps_instance_t* inst = &gps_instances[id];
 
-  size_t pos = 0;
   size_t old_pos = 0;
-  uint8_t dummy = 0;
-  size_t total_received = 0;
+  uint32_t rx_total = 0;    // ISR이 알려준 누적 DMA 위치
+  uint32_t read_total = 0;  // 파서에 넘긴 누적 위치
 
   gps_set_evt_handler(&inst->gps, gps_evt_handler);
   memset(&inst->gga_avg_data, 0, sizeof(inst->gga_avg_data));
   memset(&inst->ubx_hp_avg, 0, sizeof(ubx_hp_avg_data_t));
+  gps_avg_init(&inst->gga_avg_data.avg, 3, GPS_GGA_AVG_WINDOW);
+  gps_avg_init(&inst->ubx_hp_avg.avg, 4, GPS_HP_AVG_WINDOW);
+
+#if GPS_SURVEY_ENABLE
+  if (board_get_config()->lora_mode == LORA_MODE_BASE && id == GPS_ID_BASE) {
+    gps_survey_start(&inst->survey, GPS_SURVEY_MIN_SAMPLES,
+                     GPS_SURVEY_TARGET_ACC_MM);
+  }
+#endif
 
   bool use_led = (id == GPS_ID_BASE ? 1 : 0);
 
@@ -425,24 +730,35 @@ static void gps_process_task(void *pvParameter) {
       LOG_INFO("GPS[%d] F9P init complete", id);
   }
 
+  memset(&inst->baud, 0, sizeof(inst->baud));
+  inst->baud.cur = GPS_UART_BOOT_BAUD;
+  inst->baud.state = (GPS_UART_TARGET_BAUD == GPS_UART_BOOT_BAUD) ?
+                     GPS_BAUD_DONE : GPS_BAUD_WAIT_BOOT;
+  inst->baud.deadline = xTaskGetTickCount() + pdMS_TO_TICKS(GPS_BAUD_BOOT_TIMEOUT_MS);
+  inst->baud.last_frame = xTaskGetTickCount();
+
   while (1) {
-    xQueueReceive(inst->queue, &dummy, portMAX_DELAY); // 단순 신호 전달용. 받는 데이터 없음
+    // DMA HT/TC, IDLE 인터럽트에서 누적 DMA 위치를 알림 값으로 전달
+    // 수신이 없어도 타임아웃/수신 끊김 확인을 위해 주기적으로 깨어남
+    xTaskNotifyWait(0, 0, &rx_total,
+                    inst->baud.state == GPS_BAUD_DONE ? pdMS_TO_TICKS(GPS_BAUD_LOST_CHECK_MS)
+                                                      : pdMS_TO_TICKS(100));
 
-    if(inst->gps.nmea_data.gga.fix == GPS_FIX_INVALID)
+    if(inst->gps.sol.out.fix == GPS_FIX_INVALID)
     {
       if(use_led)
       {
         led_set_color(2, LED_COLOR_RED);
       }
     }
-    else if(inst->gps.nmea_data.gga.fix < GPS_FIX_RTK_FIX || inst->gps.nmea_data.gga.fix == GPS_FIX_RTK_FLOAT)
+    else if(inst->gps.sol.out.fix < GPS_FIX_RTK_FIX || inst->gps.sol.out.fix == GPS_FIX_RTK_FLOAT)
     {
       if(use_led)
       {
         led_set_color(2, LED_COLOR_YELLOW);
       }
     }
-    else if(inst->gps.nmea_data.gga.fix < GPS_FIX_RTK_FLOAT)
+    else if(inst->gps.sol.out.fix < GPS_FIX_RTK_FLOAT)
     {
       if(use_led)
       {
@@ -463,31 +779,41 @@ static void gps_process_task(void *pvParameter) {
     }
 
     xSemaphoreTake(inst->gps.mutex, portMAX_DELAY);
-    pos = gps_port_get_rx_pos(id);
     char* gps_recv = gps_port_get_recv_buf(id);
+    size_t buf_size = gps_port_get_recv_buf_size(id);
+    uint32_t pending = rx_total - read_total;
+
+    if (pending > buf_size) {
+      // DMA가 읽기 위치를 한 바퀴 이상 앞지름: 버퍼 내용을 믿을 수 없으므로
+      // 현재 쓰기 위치로 건너뛰고 파서를 재동기
+      inst->rx_stats.lost_bytes += pending;
+      inst->rx_stats.overrun_cnt++;
+      LOG_WARN("GPS[%d] RX overrun: %u bytes lost (total %u)", id,
+               (unsigned)pending, (unsigned)inst->rx_stats.lost_bytes);
+
+      gps_parse_reset(&inst->gps);
+      old_pos = (old_pos + pending) % buf_size;
+      read_total = rx_total;
+      pending = 0;
+    }
 
-    if (pos != old_pos) {
-      if (pos > old_pos) {
-        size_t len = pos - old_pos;
-        total_received = len;
-        LOG_DEBUG_RAW("RAW: ", &gps_recv[old_pos], len);
-        gps_parse_process(&inst->gps, &gps_recv[old_pos], pos - old_pos);
-      } else {
-        size_t len1 = GPS_UART_MAX_RECV_SIZE - old_pos;
-        size_t len2 = pos;
-        total_received = len1 + len2;
-        LOG_DEBUG_RAW("RAW: ", &gps_recv[old_pos], len1);
-        gps_parse_process(&inst->gps, &gps_recv[old_pos],
-                          GPS_UART_MAX_RECV_SIZE - old_pos);
-        if (pos > 0) {
-          LOG_DEBUG_RAW("RAW: ", gps_recv, len2);
-          gps_parse_process(&inst->gps, gps_recv, pos);
-        }
+    if (pending > 0) {
+      size_t len1 = buf_size - old_pos;
+
+      if (len1 > pending) {
+        len1 = pending;
       }
-      old_pos = pos;
-      if (old_pos == GPS_UART_MAX_RECV_SIZE) {
-        old_pos = 0;
+
+      LOG_DEBUG_RAW("RAW: ", &gps_recv[old_pos], len1);
+      gps_parse_process(&inst->gps, &gps_recv[old_pos], len1);
+      if (pending > len1) {
+        LOG_DEBUG_RAW("RAW: ", gps_recv, pending - len1);
+        gps_parse_process(&inst->gps, gps_recv, pending - len1);
       }
+
+      old_pos = (old_pos + pending) % buf_size;
+      read_total = rx_total;
+      inst->rx_stats.rx_bytes += pending;
     }
     xSemaphoreGive(inst->gps.mutex);
 
@@ -497,6 +823,13 @@ static void gps_process_task(void *pvParameter) {
       inst->config.need_send_config = false;
     }
 
+    if (gps_baud_process(inst)) {
+      // 이전 보레이트로 받은 바이트는 확인 프레임으로 세지 않도록 건너뜀
+      xTaskNotifyWait(0, 0, &rx_total, 0);
+      old_pos = (old_pos + (rx_total - read_total)) % gps_port_get_recv_buf_size(id);
+      read_total = rx_total;
+    }
+
     if(get_gga(&inst->gps, my_test, &my_len))
     {
     	LOG_ERR("[ID:%d]%s", id, my_test);
@@ -617,7 +950,11 @@ int gps_send_raw_data(gps_id_t id, const uint8_t *data, size_t len) {
     return -1;
   }
 
-  // Send directly via HAL (mutex-protected)
+  // 송신 링에 넣고 바로 반환 (DMA 전송)
+  if (inst->gps.ops->send_async) {
+    return inst->gps.ops->send_async((const char *)data, len);
+  }
+
   return inst->gps.ops->send((const char *)data, len);
 }
 
@@ -668,6 +1005,9 @@ void gps_init_all(void)
     gps_instances[i].id = (gps_id_t)i;
     gps_instances[i].enabled = true;
 
+    gps_rtcm_filter_init(&gps_instances[i].rtcm_filter, gps_rtcm_rules,
+                         GPS_RTCM_RULE_CNT, GPS_RTCM_FILTER_GNSS_MASK, true);
+
     // 초기화 시퀀스 설정
     gps_instances[i].config.seq = get_init_sequence(config->board);
     gps_instances[i].config.need_send_config = false;
@@ -692,20 +1032,7 @@ void gps_init_all(void)
       continue;
     }
 
-    // 큐 생성 및 설정
-    gps_instances[i].queue = xQueueCreate(10, sizeof(uint8_t));
-    if (gps_instances[i].queue == NULL) {
-      LOG_ERR("GPS[%d] 큐 생성 실패", i);
-      gps_instances[i].enabled = false;
-      continue;
-    }
-
-    gps_port_set_queue((gps_id_t)i, gps_instances[i].queue);
-
-    // UART 시작
-    gps_port_start(&gps_instances[i].gps);
-
-    // 태스크 생성
+    // 태스크 생성 (DMA 시작 전에 알림 대상이 있어야 함)
     char task_name[16];
     snprintf(task_name, sizeof(task_name), "gps_%d", i);
 
@@ -724,6 +1051,11 @@ void gps_init_all(void)
       continue;
     }
 
+    gps_port_set_task((gps_id_t)i, gps_instances[i].task);
+
+    // UART 시작
+    gps_port_start(&gps_instances[i].gps);
+
     LOG_INFO("GPS[%d] 초기화 완료", i);
   }
 
@@ -742,6 +1074,141 @@ gps_t* gps_get_instance_handle(gps_id_t id)
   return &gps_instances[id].gps;
 }
 
+/**
+ * @brief 최신 항법해 가져오기
+ */
+bool gps_get_latest_nav(gps_id_t id, gps_nav_t* nav)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled || !nav) {
+    return false;
+  }
+
+  return gps_get_nav(&gps_instances[id].gps, nav);
+}
+
+/**
+ * @brief 보정 메시지 사용 통계 가져오기 (F9P RXM-RTCM)
+ */
+bool gps_get_rtcm_usage(gps_id_t id, uint16_t msg_type, gps_ubx_rtcm_stat_t* stat)
+{
+  const gps_ubx_rtcm_stat_t* st;
+
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled || !stat) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  st = gps_ubx_get_rtcm_stat(&inst->gps, msg_type);
+  if (st) {
+    *stat = *st;
+  }
+  xSemaphoreGive(inst->gps.mutex);
+
+  return st != NULL;
+}
+
+/**
+ * @brief 베이스 RTCM 출력 소비자 등록
+ */
+bool gps_set_rtcm_output(gps_id_t id, gps_rtcm_out_cb_t cb, void* arg)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  // 콜백은 gps->mutex를 잡은 이벤트 핸들러에서 호출됨
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  inst->rtcm_out.cb = cb;
+  inst->rtcm_out.arg = arg;
+
+  xSemaphoreGive(inst->gps.mutex);
+
+  return true;
+}
+
+/**
+ * @brief RTCM 메시지 타입 전송 간격 변경
+ */
+bool gps_set_rtcm_interval(gps_id_t id, uint16_t msg_type, int32_t interval_ms)
+{
+  bool ret = true;
+
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  if (interval_ms < 0) {
+    gps_rtcm_filter_remove(&inst->rtcm_filter, msg_type);
+  } else {
+    ret = gps_rtcm_filter_set_interval(&inst->rtcm_filter, msg_type,
+                                       (uint32_t)interval_ms);
+  }
+
+  xSemaphoreGive(inst->gps.mutex);
+
+  return ret;
+}
+
+/**
+ * @brief RTCM 출력 위성 시스템 변경
+ */
+bool gps_set_rtcm_gnss_mask(gps_id_t id, uint8_t gnss_mask)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  gps_rtcm_filter_set_gnss_mask(&inst->rtcm_filter, gnss_mask);
+
+  xSemaphoreGive(inst->gps.mutex);
+
+  return true;
+}
+
+/**
+ * @brief RTCM 출력 필터 통계 가져오기
+ */
+bool gps_get_rtcm_filter_stats(gps_id_t id, gps_rtcm_filter_stats_t* stats)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled || !stats) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  *stats = inst->rtcm_filter.stats;
+
+  xSemaphoreGive(inst->gps.mutex);
+
+  return true;
+}
+
 /**
  * @brief GGA 평균 데이터 읽기 가능 여부
  */
@@ -767,9 +1234,155 @@ bool gps_get_gga_avg(gps_id_t id, double* lat, double* lon, double* alt)
     return false;
   }
 
-  if (lat) *lat = gps_instances[id].gga_avg_data.lat_avg;
-  if (lon) *lon = gps_instances[id].gga_avg_data.lon_avg;
-  if (alt) *alt = gps_instances[id].gga_avg_data.alt_avg;
+  const gps_avg_t* avg = &gps_instances[id].gga_avg_data.avg;
+
+  if (lat) *lat = gps_avg_mean(avg, GPS_AVG_LAT);
+  if (lon) *lon = gps_avg_mean(avg, GPS_AVG_LON);
+  if (alt) *alt = gps_avg_mean(avg, GPS_AVG_ALT);
+
+  return true;
+}
+
+/**
+ * @brief GGA 평균 표준편차 가져오기
+ */
+bool gps_get_gga_avg_stddev(gps_id_t id, double* lat, double* lon, double* alt)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  if (!gps_instances[id].gga_avg_data.can_read) {
+    return false;
+  }
+
+  const gps_avg_t* avg = &gps_instances[id].gga_avg_data.avg;
+
+  if (lat) *lat = gps_avg_stddev(avg, GPS_AVG_LAT);
+  if (lon) *lon = gps_avg_stddev(avg, GPS_AVG_LON);
+  if (alt) *alt = gps_avg_stddev(avg, GPS_AVG_ALT);
+
+  return true;
+}
+
+/**
+ * @brief UBX 고정밀 위치 평균 가져오기
+ */
+bool gps_get_hp_avg(gps_id_t id, gps_hp_avg_t* out)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled || !out) {
+    return false;
+  }
+
+  const ubx_hp_avg_data_t* hp = &gps_instances[id].ubx_hp_avg;
+
+  if (!hp->can_read) {
+    return false;
+  }
+
+  out->lat = gps_avg_mean(&hp->avg, GPS_AVG_LAT) * 1e-7;
+  out->lon = gps_avg_mean(&hp->avg, GPS_AVG_LON) * 1e-7;
+  out->height = gps_avg_mean(&hp->avg, GPS_AVG_ALT) * 1e-3;
+  out->msl = gps_avg_mean(&hp->avg, GPS_AVG_MSL) * 1e-3;
+  out->lat_std = gps_avg_stddev(&hp->avg, GPS_AVG_LAT) * 1e-7;
+  out->lon_std = gps_avg_stddev(&hp->avg, GPS_AVG_LON) * 1e-7;
+  out->height_std = gps_avg_stddev(&hp->avg, GPS_AVG_ALT) * 1e-3;
+  out->hacc = hp->hacc * 1e-4;
+  out->vacc = hp->vacc * 1e-4;
+  out->count = gps_avg_count(&hp->avg);
+
+  return true;
+}
+
+/**
+ * @brief 위치 평균 윈도우 크기 변경
+ */
+bool gps_set_avg_window(gps_id_t id, uint16_t gga_window, uint16_t hp_window)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  // 평균 갱신은 gps->mutex를 잡은 이벤트 핸들러에서만 일어남
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  if (gga_window) {
+    gps_avg_set_window(&inst->gga_avg_data.avg, gga_window);
+    inst->gga_avg_data.can_read = false;
+  }
+
+  if (hp_window) {
+    gps_avg_set_window(&inst->ubx_hp_avg.avg, hp_window);
+    inst->ubx_hp_avg.can_read = false;
+  }
+
+  xSemaphoreGive(inst->gps.mutex);
+
+  return true;
+}
+
+/**
+ * @brief 베이스 좌표 측량 (재)시작
+ */
+bool gps_start_survey(gps_id_t id, uint32_t min_samples, uint32_t target_acc_mm)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  gps_survey_start(&inst->survey, min_samples, target_acc_mm);
+  xSemaphoreGive(inst->gps.mutex);
+
+  LOG_INFO("GPS[%d] Survey start (min %lu, acc %lu mm)", id,
+           (unsigned long)min_samples, (unsigned long)target_acc_mm);
+  return true;
+}
+
+/**
+ * @brief 베이스 좌표 측량 결과 가져오기
+ */
+bool gps_get_survey(gps_id_t id, gps_survey_result_t* res)
+{
+  bool ret;
+
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled || !res) {
+    return false;
+  }
+
+  gps_instance_t* inst = &gps_instances[id];
+
+  // int64 누적값은 한 번에 읽히지 않으므로 핸들러와 같은 뮤텍스로 보호
+  if (xSemaphoreTake(inst->gps.mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+    return false;
+  }
+
+  ret = gps_survey_get_result(&inst->survey, res);
+  xSemaphoreGive(inst->gps.mutex);
+
+  return ret;
+}
+
+/**
+ * @brief GPS DMA 수신 통계 가져오기
+ */
+bool gps_get_rx_stats(gps_id_t id, uint32_t* rx_bytes, uint32_t* lost_bytes)
+{
+  if (id >= GPS_ID_MAX || !gps_instances[id].enabled) {
+    return false;
+  }
+
+  if (rx_bytes) *rx_bytes = gps_instances[id].rx_stats.rx_bytes;
+  if (lost_bytes) *lost_bytes = gps_instances[id].rx_stats.lost_bytes;
 
   return true;
 }
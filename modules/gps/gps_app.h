@@ -2,11 +2,41 @@
 #define GPS_APP_H
 
 #include "gps.h"
+#include "gps_survey.h"
+#include "gps_rtcm_filter.h"
 #include "board_config.h"
 #include "FreeRTOS.h"
 #include "queue.h"
 #include "task.h"
 
+/**
+ * @brief UBX 고정밀 위치 평균 (NAV-HPPOSLLH 이동 평균)
+ */
+typedef struct {
+  double lat;         // [deg]
+  double lon;         // [deg]
+  double height;      // 타원체고 [m]
+  double msl;         // 해발고 [m]
+  double lat_std;     // 위도 표준편차 [deg]
+  double lon_std;     // 경도 표준편차 [deg]
+  double height_std;  // 타원체고 표준편차 [m]
+  double hacc;        // 마지막 수평 정확도 [m]
+  double vacc;        // 마지막 수직 정확도 [m]
+  uint16_t count;     // 평균에 들어간 샘플 수
+} gps_hp_avg_t;
+
+/**
+ * @brief 베이스 RTCM 출력 콜백 (GPS 태스크, gps->mutex 잡힌 상태)
+ *
+ * 프레임은 핸들러 안에서만 유효하다. 큐에 넣어 나중에 보내려면
+ * rtcm_frame_ref()로 참조를 잡는다 (lora_queue_enqueue_rtcm_frame은 자동).
+ *
+ * @param id GPS ID
+ * @param frame 필터를 통과한 RTCM 프레임
+ * @param arg 등록 시 넘긴 인자
+ */
+typedef void (*gps_rtcm_out_cb_t)(gps_id_t id, rtcm_frame_t* frame, void* arg);
+
 /**
  * @brief GPS 초기화 (board_config 기반)
  *
@@ -36,6 +66,77 @@ gps_t* gps_get_handle(void);
  */
 gps_t* gps_get_instance_handle(gps_id_t id);
 
+/**
+ * @brief 최신 항법해 가져오기
+ *
+ * 파서가 GGA/HPPOSLLH마다 게시한 스냅샷을 잠금 없이 복사한다.
+ * 파싱 중에도 기다리지 않으므로 어느 태스크에서나 호출할 수 있다.
+ *
+ * @param id GPS ID
+ * @param nav 항법해 출력
+ * @return true: 성공, false: 실패 또는 아직 게시 전
+ */
+bool gps_get_latest_nav(gps_id_t id, gps_nav_t* nav);
+
+/**
+ * @brief 보정 메시지 사용 통계 가져오기 (F9P RXM-RTCM)
+ *
+ * 수신기에서 UBX-RXM-RTCM 출력을 켜야 쌓인다. used가 0이고 unused만
+ * 늘어나는 타입은 수신기가 쓰지 않는 보정 메시지다.
+ *
+ * @param id GPS ID
+ * @param msg_type RTCM 메시지 타입
+ * @param stat 통계 출력
+ * @return true: 성공, false: 실패 또는 해당 타입 수신 기록 없음
+ */
+bool gps_get_rtcm_usage(gps_id_t id, uint16_t msg_type, gps_ubx_rtcm_stat_t* stat);
+
+/**
+ * @brief 베이스 RTCM 출력 소비자 등록
+ *
+ * GPS_RTCM_FILTER_RULES 필터를 통과한 프레임만 전달된다.
+ * 등록된 소비자가 없으면 MSM7 -> MSM4 변환과 필터를 건너뛴다 (필터 통계도 그대로).
+ *
+ * @param id GPS ID
+ * @param cb 출력 콜백 (NULL: 해제)
+ * @param arg 콜백 인자
+ * @return true: 성공, false: 실패
+ */
+bool gps_set_rtcm_output(gps_id_t id, gps_rtcm_out_cb_t cb, void* arg);
+
+/**
+ * @brief RTCM 메시지 타입 전송 간격 변경
+ *
+ * 규칙에 없는 타입이면 추가한다. 음수를 주면 규칙을 지워서 더 이상
+ * 내보내지 않는다 (화이트리스트).
+ *
+ * @param id GPS ID
+ * @param msg_type RTCM 메시지 타입
+ * @param interval_ms 최소 전송 간격 [ms] (0: 매번, 음수: 버림)
+ * @return true: 성공, false: 실패 또는 규칙 테이블 가득 참
+ */
+bool gps_set_rtcm_interval(gps_id_t id, uint16_t msg_type, int32_t interval_ms);
+
+/**
+ * @brief RTCM 출력 위성 시스템 변경
+ *
+ * 로버가 추적하지 않는 위성 시스템의 MSM/궤도력을 버릴 때 사용한다.
+ *
+ * @param id GPS ID
+ * @param gnss_mask GPS_RTCM_GNSS_BIT(RTCM_GNSS_xxx) 조합
+ * @return true: 성공, false: 실패
+ */
+bool gps_set_rtcm_gnss_mask(gps_id_t id, uint8_t gnss_mask);
+
+/**
+ * @brief RTCM 출력 필터 통계 가져오기
+ *
+ * @param id GPS ID
+ * @param stats 통계 출력
+ * @return true: 성공, false: 실패
+ */
+bool gps_get_rtcm_filter_stats(gps_id_t id, gps_rtcm_filter_stats_t* stats);
+
 /**
  * @brief GGA 평균 데이터 읽기 가능 여부
  *
@@ -55,6 +156,70 @@ bool gps_gga_avg_can_read(gps_id_t id);
  */
 bool gps_get_gga_avg(gps_id_t id, double* lat, double* lon, double* alt);
 
+/**
+ * @brief GGA 평균 표준편차 가져오기 (수렴 판단용)
+ *
+ * @param id GPS ID
+ * @param lat 위도 표준편차 [deg] 출력 (NULL 가능)
+ * @param lon 경도 표준편차 [deg] 출력 (NULL 가능)
+ * @param alt 고도 표준편차 [m] 출력 (NULL 가능)
+ * @return true: 성공, false: 실패
+ */
+bool gps_get_gga_avg_stddev(gps_id_t id, double* lat, double* lon, double* alt);
+
+/**
+ * @brief UBX 고정밀 위치 평균 가져오기 (NAV-HPPOSLLH)
+ *
+ * @param id GPS ID
+ * @param out 평균 출력
+ * @return true: 성공, false: 실패 (윈도우가 아직 안 참)
+ */
+bool gps_get_hp_avg(gps_id_t id, gps_hp_avg_t* out);
+
+/**
+ * @brief 위치 평균 윈도우 크기 변경
+ *
+ * 변경한 평균은 누적된 샘플을 버리고 다시 채운다.
+ *
+ * @param id GPS ID
+ * @param gga_window GGA 평균 윈도우 (0: 유지)
+ * @param hp_window UBX 고정밀 평균 윈도우 (0: 유지)
+ * @return true: 성공, false: 실패
+ */
+bool gps_set_avg_window(gps_id_t id, uint16_t gga_window, uint16_t hp_window);
+
+/**
+ * @brief 베이스 좌표 측량 (재)시작
+ *
+ * 누적된 샘플은 버린다. 완료되면 GPS_SURVEY_APPLY_FIXED 설정에 따라
+ * 수신기를 고정 좌표 모드로 전환한다.
+ *
+ * @param id GPS ID
+ * @param min_samples 완료 판정 최소 샘플 수
+ * @param target_acc_mm 완료 판정 평균 정확도 [mm]
+ * @return true: 성공, false: 실패
+ */
+bool gps_start_survey(gps_id_t id, uint32_t min_samples, uint32_t target_acc_mm);
+
+/**
+ * @brief 베이스 좌표 측량 결과 가져오기
+ *
+ * @param id GPS ID
+ * @param res 결과 출력 (state로 진행/완료 확인)
+ * @return true: 샘플 있음, false: 실패 또는 샘플 없음
+ */
+bool gps_get_survey(gps_id_t id, gps_survey_result_t* res);
+
+/**
+ * @brief GPS DMA 수신 통계 가져오기
+ *
+ * @param id GPS ID
+ * @param rx_bytes 파서에 전달한 누적 바이트 (NULL 가능)
+ * @param lost_bytes DMA 앞지름으로 버린 누적 바이트 (NULL 가능)
+ * @return true: 성공, false: 실패
+ */
+bool gps_get_rx_stats(gps_id_t id, uint32_t* rx_bytes, uint32_t* lost_bytes);
+
 /**
  * @brief GPS 명령 전송 (동기식, 응답 대기)
  *
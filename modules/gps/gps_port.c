@@ -1,5 +1,6 @@
 #include "gps_port.h"
 #include "board_config.h"
+#include "gps_config.h"
 #include "stm32f4xx_hal.h"
 #include "stm32f4xx_ll_bus.h"
 #include "stm32f4xx_ll_cortex.h"
@@ -10,6 +11,7 @@
 #include "stm32f4xx_ll_system.h"
 #include "stm32f4xx_ll_usart.h"
 #include "stm32f4xx_ll_utils.h"
+#include "uart_tx.h"
 
 #ifndef TAG
   #define TAG "GPS_PORT"
@@ -17,11 +19,43 @@
 
 #include "log.h"
 
-static char gps_recv_buf[GPS_CNT][2048];
-static QueueHandle_t gps_queues[GPS_CNT] = {NULL};
+/**
+ * @brief GPS 포트별 DMA 수신 상태
+ */
+typedef struct {
+  DMA_TypeDef *dma;
+  uint32_t stream;
+  char *buf;               ///< DMA 순환 버퍼
+  size_t size;             ///< 버퍼 크기
+  TaskHandle_t task;       ///< 위치 알림 받을 태스크
+  uint32_t last_idx;       ///< 마지막 인터럽트 시점의 버퍼 인덱스
+  volatile uint32_t total; ///< 누적 DMA 위치 (수신 바이트 수)
+} gps_rx_port_t;
+
+static char gps_uart2_recv_buf[GPS_UART2_RX_BUF_SIZE];
+
+static gps_rx_port_t gps_uart2_rx = {
+  .dma = DMA1,
+  .stream = LL_DMA_STREAM_5,
+  .buf = gps_uart2_recv_buf,
+  .size = sizeof(gps_uart2_recv_buf),
+};
+
+// GPS ID -> 수신 포트 (gps_port_init_instance에서 할당)
+static gps_rx_port_t *gps_rx_ports[GPS_ID_MAX] = {NULL};
+
+static uint8_t gps_uart2_tx_buf[GPS_UART2_TX_BUF_SIZE];
 
-// UART TX mutex for thread-safe transmission
-static SemaphoreHandle_t gps_uart_tx_mutex = NULL;
+// USART2_TX: DMA1 Stream6 Channel4
+static uart_tx_t gps_uart2_tx = {
+  .uart = USART2,
+  .dma = DMA1,
+  .stream = LL_DMA_STREAM_6,
+  .channel = LL_DMA_CHANNEL_4,
+  .irqn = DMA1_Stream6_IRQn,
+  .ring = gps_uart2_tx_buf,
+  .ring_size = sizeof(gps_uart2_tx_buf),
+};
 
 static gps_type_t uart2_gps_type = GPS_TYPE_F9P;
 //static gps_type_t uart4_gps_type = GPS_TYPE_F9P;
@@ -87,7 +121,7 @@ static void gps_uart2_init(void) {
   /* USER CODE BEGIN USART2_Init 1 */
 
   /* USER CODE END USART2_Init 1 */
-  USART_InitStruct.BaudRate = 38400;
+  USART_InitStruct.BaudRate = GPS_UART_BOOT_BAUD;
   USART_InitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
   USART_InitStruct.StopBits = LL_USART_STOPBITS_1;
   USART_InitStruct.Parity = LL_USART_PARITY_NONE;
@@ -125,7 +159,7 @@ int gps_rtk_uart2_init(void) {
   gps_uart2_dma_init();
   gps_uart2_init();
 
-  return 0;
+  return uart_tx_init(&gps_uart2_tx);
 }
 
 /**
@@ -133,11 +167,15 @@ int gps_rtk_uart2_init(void) {
  *
  */
 void gps_uart2_comm_start(void) {
+  gps_uart2_rx.last_idx = 0;
+  gps_uart2_rx.total = 0;
+
   LL_DMA_SetPeriphAddress(DMA1, LL_DMA_STREAM_5, (uint32_t)&USART2->DR);
-  LL_DMA_SetMemoryAddress(DMA1, LL_DMA_STREAM_5, (uint32_t)&gps_recv_buf[uart2_gps_id]);
-  LL_DMA_SetDataLength(DMA1, LL_DMA_STREAM_5, sizeof(gps_recv_buf[uart2_gps_id]));
-  //  LL_DMA_EnableIT_HT(DMA2, LL_DMA_STREAM_1);
-  //  LL_DMA_EnableIT_TC(DMA2, LL_DMA_STREAM_1);
+  LL_DMA_SetMemoryAddress(DMA1, LL_DMA_STREAM_5, (uint32_t)gps_uart2_rx.buf);
+  LL_DMA_SetDataLength(DMA1, LL_DMA_STREAM_5, gps_uart2_rx.size);
+  // 유휴 구간 없이 연속 수신해도 버퍼 절반마다 태스크를 깨움
+  LL_DMA_EnableIT_HT(DMA1, LL_DMA_STREAM_5);
+  LL_DMA_EnableIT_TC(DMA1, LL_DMA_STREAM_5);
   LL_DMA_EnableIT_TE(DMA1, LL_DMA_STREAM_5);
   LL_DMA_EnableIT_FE(DMA1, LL_DMA_STREAM_5);
   LL_DMA_EnableIT_DME(DMA1, LL_DMA_STREAM_5);
@@ -180,26 +218,70 @@ int gps_rtk_start(void) {
   return 0;
 }
 
+/**
+ * @brief USART2 송신 (전송 완료까지 대기)
+ *
+ * DMA로 보내고 완료 인터럽트를 기다리는 동안 태스크는 블로킹된다.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공, -1: 실패
+ */
 int gps_uart2_send(const char *data, size_t len) {
-  // Take mutex to prevent concurrent UART transmissions
-  if (gps_uart_tx_mutex) {
-    xSemaphoreTake(gps_uart_tx_mutex, portMAX_DELAY);
+  if (uart_tx_send(&gps_uart2_tx, data, len, portMAX_DELAY) < 0) {
+    return -1;
   }
 
-  for (int i = 0; i < len; i++) {
-    while (!LL_USART_IsActiveFlag_TXE(USART2))
-      ;
-    LL_USART_TransmitData8(USART2, *(data + i));
-  }
+  return uart_tx_flush(&gps_uart2_tx, portMAX_DELAY);
+}
 
-  while (!LL_USART_IsActiveFlag_TC(USART2))
-    ;
+/**
+ * @brief USART2 비동기 송신
+ *
+ * 송신 링에 복사만 하고 반환한다. 링에 공간이 없으면 최대 100ms 대기.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공, -1: 실패 (일부만 들어간 경우 포함)
+ */
+int gps_uart2_send_async(const char *data, size_t len) {
+  int ret = uart_tx_send(&gps_uart2_tx, data, len, 100);
 
-  // Release mutex
-  if (gps_uart_tx_mutex) {
-    xSemaphoreGive(gps_uart_tx_mutex);
+  return (ret == (int)len) ? 0 : -1;
+}
+
+/**
+ * @brief USART2 보레이트 변경
+ *
+ * 송신 링이 모두 나간 뒤 UE만 잠시 내렸다 올린다.
+ * DMA 스트림과 순환 버퍼 위치는 그대로 유지되므로 수신 누적 위치가 끊기지 않는다.
+ * 전환 순간 깨진 바이트는 파서가 sync부터 다시 찾는다.
+ *
+ * @param baud 보레이트
+ * @return int 0: 성공, -1: 실패
+ */
+int gps_uart2_set_baud(uint32_t baud) {
+  LL_RCC_ClocksTypeDef clocks;
+
+  if (baud == 0) {
+    return -1;
   }
 
+  // 새 송신이 끼어들지 않도록 잠근 채 링을 비우고 변경
+  xSemaphoreTake(gps_uart2_tx.lock, portMAX_DELAY);
+  uart_tx_flush(&gps_uart2_tx, portMAX_DELAY);
+
+  LL_RCC_GetSystemClocksFreq(&clocks);
+
+  LL_USART_Disable(USART2);
+  LL_USART_SetBaudRate(USART2, clocks.PCLK1_Frequency,
+                       LL_USART_OVERSAMPLING_16, baud);
+  LL_USART_ClearFlag_ORE(USART2);
+  LL_USART_ClearFlag_FE(USART2);
+  LL_USART_Enable(USART2);
+
+  xSemaphoreGive(gps_uart2_tx.lock);
+
   return 0;
 }
 
@@ -209,9 +291,35 @@ static const gps_hal_ops_t gps_rtk_uart2_ops = {
   .start = gps_rtk_start,
   .stop = NULL,
   .send = gps_uart2_send,
+  .send_async = gps_uart2_send_async,
   .recv = NULL,
+  .set_baud = gps_uart2_set_baud,
 };
 
+/**
+ * @brief DMA 위치 갱신 후 태스크 알림 (ISR 전용)
+ *
+ * 이전 인터럽트 이후 DMA가 쓴 만큼 누적 위치를 전진시킨다.
+ * HT/TC가 버퍼 절반마다 발생하므로 인터럽트 사이 이동량은 버퍼 크기보다 작다.
+ *
+ * @param rx 수신 포트
+ * @param woken portYIELD_FROM_ISR 플래그
+ */
+static void gps_rx_notify_from_isr(gps_rx_port_t *rx, BaseType_t *woken) {
+  uint32_t idx = rx->size - LL_DMA_GetDataLength(rx->dma, rx->stream);
+
+  if (idx >= rx->size) {
+    idx = 0;
+  }
+
+  rx->total += (idx + rx->size - rx->last_idx) % rx->size;
+  rx->last_idx = idx;
+
+  if (rx->task) {
+    xTaskNotifyFromISR(rx->task, rx->total, eSetValueWithOverwrite, woken);
+  }
+}
+
 /**
  * @brief This function handles USART2 global interrupt.
  */
@@ -219,12 +327,7 @@ void USART2_IRQHandler(void) {
    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
   if (LL_USART_IsActiveFlag_IDLE(USART2)) {
-    uint8_t dummy = 0;
-
-    if (gps_queues[0]) {
-      xQueueSendFromISR(gps_queues[0], &dummy, &xHigherPriorityTaskWoken);
-    }
-
+    gps_rx_notify_from_isr(&gps_uart2_rx, &xHigherPriorityTaskWoken);
     LL_USART_ClearFlag_IDLE(USART2);
   }
 
@@ -247,18 +350,50 @@ void USART2_IRQHandler(void) {
 /**
  * @brief This function handles DMA1 stream5 global interrupt.
  */
-void DMA1_Stream5_IRQHandler(void) {}
+void DMA1_Stream5_IRQHandler(void) {
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+  bool notify = false;
+
+  if (LL_DMA_IsEnabledIT_HT(DMA1, LL_DMA_STREAM_5) &&
+      LL_DMA_IsActiveFlag_HT5(DMA1)) {
+    LL_DMA_ClearFlag_HT5(DMA1);
+    notify = true;
+  }
+
+  if (LL_DMA_IsEnabledIT_TC(DMA1, LL_DMA_STREAM_5) &&
+      LL_DMA_IsActiveFlag_TC5(DMA1)) {
+    LL_DMA_ClearFlag_TC5(DMA1);
+    notify = true;
+  }
+
+  if (LL_DMA_IsActiveFlag_TE5(DMA1)) {
+    LL_DMA_ClearFlag_TE5(DMA1);
+  }
+  if (LL_DMA_IsActiveFlag_FE5(DMA1)) {
+    LL_DMA_ClearFlag_FE5(DMA1);
+  }
+  if (LL_DMA_IsActiveFlag_DME5(DMA1)) {
+    LL_DMA_ClearFlag_DME5(DMA1);
+  }
+
+  if (notify) {
+    gps_rx_notify_from_isr(&gps_uart2_rx, &xHigherPriorityTaskWoken);
+  }
+
+  portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
 
 
+/**
+ * @brief This function handles DMA1 stream6 global interrupt (USART2_TX).
+ */
+void DMA1_Stream6_IRQHandler(void) {
+  uart_tx_irq_handler(&gps_uart2_tx);
+}
 
 int gps_port_init_instance(gps_t* gps_handle, gps_id_t id, gps_type_t type) {
   if (id >= GPS_ID_MAX) return -1;
 
-  // Create UART TX mutex (once)
-  if (gps_uart_tx_mutex == NULL) {
-    gps_uart_tx_mutex = xSemaphoreCreateMutex();
-  }
-
   const board_config_t* config = board_get_config();
 
   LOG_INFO("GPS[%d] Port 초기화 시작 (보드: %d, GPS 타입: %s)",
@@ -272,6 +407,7 @@ int gps_port_init_instance(gps_t* gps_handle, gps_id_t id, gps_type_t type) {
     // Base 보드: 항상 USART2
     uart2_gps_type = type;
     uart2_gps_id = id;
+    gps_rx_ports[id] = &gps_uart2_rx;
     gps_handle->ops = &gps_rtk_uart2_ops;
     if (gps_handle->ops->init) {
       gps_handle->ops->init();
@@ -293,6 +429,7 @@ int gps_port_init_instance(gps_t* gps_handle, gps_id_t id, gps_type_t type) {
     if (id == GPS_ID_BASE) {
       uart2_gps_type = type;
       uart2_gps_id = id;
+      gps_rx_ports[id] = &gps_uart2_rx;
       gps_handle->ops = &gps_rtk_uart2_ops;
       if (gps_handle->ops->init) {
         gps_handle->ops->init();
@@ -336,33 +473,50 @@ void gps_port_stop(gps_t* gps_handle) {
   gps_handle->ops->stop();
 }
 
+/**
+ * @brief GPS UART 보레이트 변경
+ */
+int gps_port_set_baud(gps_t* gps_handle, uint32_t baud) {
+  if (!gps_handle || !gps_handle->ops || !gps_handle->ops->set_baud) {
+    LOG_ERR("GPS set baud failed: invalid handle or ops");
+    return -1;
+  }
+
+  return gps_handle->ops->set_baud(baud);
+}
+
 /**
  * @brief GPS 수신 버퍼 위치 가져오기
  */
 uint32_t gps_port_get_rx_pos(gps_id_t id) {
-  if (id >= GPS_CNT) return 0;
-
-  const board_config_t* config = board_get_config();
-  uint32_t dma_stream_num = 0;
+  if (id >= GPS_ID_MAX || !gps_rx_ports[id]) return 0;
 
-  dma_stream_num = LL_DMA_STREAM_5;
+  gps_rx_port_t *rx = gps_rx_ports[id];
 
-  return sizeof(gps_recv_buf[id]) - LL_DMA_GetDataLength(DMA1, dma_stream_num);
+  return rx->size - LL_DMA_GetDataLength(rx->dma, rx->stream);
 }
 
 /**
  * @brief GPS 수신 버퍼 포인터 가져오기
  */
 char* gps_port_get_recv_buf(gps_id_t id) {
-  if (id >= GPS_CNT) return NULL;
-  return gps_recv_buf[id];
+  if (id >= GPS_ID_MAX || !gps_rx_ports[id]) return NULL;
+  return gps_rx_ports[id]->buf;
+}
+
+/**
+ * @brief GPS 수신 버퍼 크기 가져오기
+ */
+size_t gps_port_get_recv_buf_size(gps_id_t id) {
+  if (id >= GPS_ID_MAX || !gps_rx_ports[id]) return 0;
+  return gps_rx_ports[id]->size;
 }
 
 /**
- * @brief GPS 인터럽트 핸들러용 큐 설정
+ * @brief GPS 수신 알림 태스크 설정
  */
-void gps_port_set_queue(gps_id_t id, QueueHandle_t queue) {
-  if (id < GPS_CNT) {
-    gps_queues[id] = queue;
+void gps_port_set_task(gps_id_t id, TaskHandle_t task) {
+  if (id < GPS_ID_MAX && gps_rx_ports[id]) {
+    gps_rx_ports[id]->task = task;
   }
 }
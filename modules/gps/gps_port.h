@@ -9,8 +9,38 @@
 int gps_port_init_instance(gps_t* gps_handle, gps_id_t id, gps_type_t type);
 void gps_port_start(gps_t* gps_handle);
 void gps_port_stop(gps_t* gps_handle);
+
+/**
+ * @brief GPS UART 보레이트 변경
+ *
+ * DMA 수신은 멈추지 않고 USART 보레이트만 바꾼다.
+ *
+ * @param gps_handle GPS 핸들
+ * @param baud 보레이트
+ * @return int 0: 성공, -1: 실패
+ */
+int gps_port_set_baud(gps_t* gps_handle, uint32_t baud);
 uint32_t gps_port_get_rx_pos(gps_id_t id);
 char* gps_port_get_recv_buf(gps_id_t id);
-void gps_port_set_queue(gps_id_t id, QueueHandle_t queue);
+
+/**
+ * @brief DMA 수신 버퍼 크기
+ *
+ * @param id GPS ID
+ * @return size_t 버퍼 크기 (포트 미할당 시 0)
+ */
+size_t gps_port_get_recv_buf_size(gps_id_t id);
+
+/**
+ * @brief 수신 알림 태스크 설정
+ *
+ * DMA HT/TC, USART IDLE 인터럽트마다 태스크 알림 값으로
+ * 누적 DMA 위치(포트 시작 후 수신한 총 바이트 수, 32비트 순환)를 전달한다.
+ * 버퍼 인덱스는 (누적 위치 % 버퍼 크기).
+ *
+ * @param id GPS ID
+ * @param task 알림 받을 태스크
+ */
+void gps_port_set_task(gps_id_t id, TaskHandle_t task);
 
 #endif
@@ -472,6 +472,20 @@ static void socket_state_check_callback(gsm_t *gsm, gsm_cmd_t cmd, void *msg, bo
 
  
 
+  tcp_pbuf_pool_stats_t pbuf_stats;
+
+  tcp_pbuf_pool_get_stats(&pbuf_stats);
+
+  LOG_INFO("   pbuf 풀: 사용 %u/%u, 최대 %u, 할당 실패 %lu, 수신 유실 %lu",
+
+           pbuf_stats.in_use, pbuf_stats.total,
+
+           pbuf_stats.high_water, pbuf_stats.alloc_failed,
+
+           pbuf_stats.rx_dropped);
+
+ 
+
   if (!msg || cmd != GSM_CMD_QISTATE) {
 
     LOG_INFO("   소켓 상태: 활성 소켓 없음");
@@ -11,6 +11,7 @@
 #include "stm32f4xx_ll_usart.h"
 #include "stm32f4xx_ll_utils.h"
 #include "task.h"
+#include "uart_tx.h"
 
 #define GSM_PORT_UART USART1
 #define GSM_PORT_UART_DMA DMA2
@@ -22,8 +23,23 @@
 #define GSM_PORT_GPIO_AIRPLANE_PIN GPIO_PIN_5
 #define GSM_PORT_GPIO_WAKEUP_PIN GPIO_PIN_6
 
+#define GSM_PORT_UART_TX_BUF_SIZE 2048 // AT 명령 + TCP 세그먼트(1460)
+
 extern char gsm_mem[2048];
 
+static uint8_t gsm_uart_tx_buf[GSM_PORT_UART_TX_BUF_SIZE];
+
+// USART1_TX: DMA2 Stream7 Channel4
+static uart_tx_t gsm_uart_tx = {
+  .uart = GSM_PORT_UART,
+  .dma = DMA2,
+  .stream = LL_DMA_STREAM_7,
+  .channel = LL_DMA_CHANNEL_4,
+  .irqn = DMA2_Stream7_IRQn,
+  .ring = gsm_uart_tx_buf,
+  .ring_size = sizeof(gsm_uart_tx_buf),
+};
+
 /**
  * Enable DMA controller clock
  */
@@ -151,6 +167,38 @@ void gsm_port_gpio_start(void) {
                     GPIO_PIN_RESET); // wakeup
 }
 
+/**
+ * @brief EC25 UART 전송 (HAL ops 콜백)
+ *
+ * DMA로 보내고 전송 완료까지 태스크를 블로킹한다.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공, -1: 실패
+ */
+int gsm_uart_send(const char *data, size_t len) {
+  if (uart_tx_send(&gsm_uart_tx, data, len, portMAX_DELAY) < 0) {
+    return -1;
+  }
+
+  return uart_tx_flush(&gsm_uart_tx, portMAX_DELAY);
+}
+
+/**
+ * @brief EC25 UART 비동기 전송 (HAL ops 콜백)
+ *
+ * 송신 링에 복사하고 바로 반환한다. 링에 공간이 없으면 최대 100ms 대기.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공, -1: 실패
+ */
+int gsm_uart_send_async(const char *data, size_t len) {
+  int ret = uart_tx_send(&gsm_uart_tx, data, len, 100);
+
+  return (ret == (int)len) ? 0 : -1;
+}
+
 /**
  * @brief dma 버퍼 위치 반환
  *
@@ -164,6 +212,7 @@ uint32_t gsm_get_rx_pos(void) {
 void gsm_port_init(void) {
   gsm_dma_init();
   gsm_uart_init();
+  uart_tx_init(&gsm_uart_tx);
 }
 
 void gsm_start(void) {
@@ -250,3 +299,10 @@ void DMA2_Stream2_IRQHandler(void) {
 
   /* USER CODE END DMA2_Stream2_IRQn 1 */
 }
+
+/**
+ * @brief This function handles DMA2 stream7 global interrupt (USART1_TX).
+ */
+void DMA2_Stream7_IRQHandler(void) {
+  uart_tx_irq_handler(&gsm_uart_tx);
+}
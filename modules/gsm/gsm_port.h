@@ -21,4 +21,26 @@ void gsm_start(void);
  */
 int gsm_port_reset(void);
 
+/**
+ * @brief EC25 UART 전송 (HAL ops 콜백)
+ *
+ * 전송 완료까지 대기한다.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공
+ */
+int gsm_uart_send(const char *data, size_t len);
+
+/**
+ * @brief EC25 UART 비동기 전송 (HAL ops 콜백)
+ *
+ * 송신 링에 넣고 전송 완료를 기다리지 않는다.
+ *
+ * @param data 전송 데이터
+ * @param len 데이터 길이
+ * @return int 0: 성공, -1: 실패
+ */
+int gsm_uart_send_async(const char *data, size_t len);
+
 #endif
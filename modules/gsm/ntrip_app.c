@@ -1,6 +1,7 @@
 #include "ntrip_app.h"
 #include "FreeRTOS.h"
 #include "task.h"
+#include "queue.h"
 #include "tcp_socket.h"
 #include "gps_app.h"
 #include <string.h>
@@ -24,6 +25,10 @@
 #define NTRIP_MAX_TIMEOUT_COUNT 3  // 연속 타임아웃 최대 허용 횟수
 #define NTRIP_RECONNECT_DELAY_MS 2000  // 재연결 대기 시간 (ms)
 
+#define NTRIP_GGA_MIN_INTERVAL_MS 1000  // GGA 최소 전송 간격 (ms)
+#define NTRIP_GGA_KEEPALIVE_MS 10000    // 새 GGA가 없을 때 마지막 GGA 재전송 주기 (ms)
+#define NTRIP_GGA_MAX_LEN 100
+
 // NTRIP HTTP 요청
 static const char NTRIP_HTTP_REQUEST[] =
     "GET /SONP-RTCM32 HTTP/1.0\r\n"
@@ -39,6 +44,14 @@ uint8_t recv_buf[1500];
 static tcp_socket_t *g_ntrip_socket = NULL;
 static bool g_ntrip_ready = false;  // 데이터 송신 가능 여부 (연결 완료 플래그)
 
+// GGA 업링크 메일박스 (길이 1, 항상 최신 GGA로 덮어씀)
+typedef struct {
+  char data[NTRIP_GGA_MAX_LEN];
+  uint8_t len;
+} ntrip_gga_msg_t;
+
+static QueueHandle_t g_gga_mailbox = NULL;
+
 /**
  * @brief NTRIP 소켓 포인터 가져오기 (GGA 전송용)
  * @return NTRIP 소켓 포인터 (NULL: 연결 안됨 또는 준비 안됨)
@@ -51,6 +64,20 @@ tcp_socket_t* ntrip_get_socket(void) {
   return NULL;
 }
 
+void ntrip_post_gga(const char *gga, uint8_t len) {
+  ntrip_gga_msg_t msg;
+
+  if (!g_gga_mailbox || !gga || len == 0 || len > NTRIP_GGA_MAX_LEN) {
+    return;
+  }
+
+  memcpy(msg.data, gga, len);
+  msg.len = len;
+
+  // ✅ 논블로킹: 이전 GGA가 아직 안 나갔으면 최신 값으로 교체
+  xQueueOverwrite(g_gga_mailbox, &msg);
+}
+
 static int ntrip_connect_to_server(tcp_socket_t *sock) {
   int ret;
   int retry_count = 0;
@@ -183,7 +210,12 @@ static void ntrip_tcp_recv_task(void *pvParameter) {
 
         LOG_INFO("  %04X: %-48s | %s", i, hex_str, ascii_str);
       }
-      gps_handle->ops->send((const char*)recv_buf, ret);
+      // 보정 데이터는 송신 링에 넣고 바로 다음 수신으로 (DMA가 전송)
+      if (gps_handle->ops->send_async) {
+        gps_handle->ops->send_async((const char*)recv_buf, ret);
+      } else {
+        gps_handle->ops->send((const char*)recv_buf, ret);
+      }
     } else if (ret == 0) {
       // 타임아웃
       timeout_count++;
@@ -267,7 +299,57 @@ static void ntrip_tcp_recv_task(void *pvParameter) {
   vTaskDelete(NULL);
 }
 
+/**
+ * @brief NTRIP GGA 업링크 태스크
+ *
+ * GPS 태스크가 올려둔 최신 GGA를 꺼내 전송한다.
+ * - 최소 전송 간격(NTRIP_GGA_MIN_INTERVAL_MS) 제한
+ * - 새 GGA가 없으면 NTRIP_GGA_KEEPALIVE_MS마다 마지막 GGA 재전송 (keepalive)
+ * - 모뎀 응답이 느려도 GPS 파싱에는 영향 없음
+ */
+static void ntrip_uplink_task(void *pvParameter) {
+  ntrip_gga_msg_t gga = {0};
+  TickType_t last_send = 0;
+  (void)pvParameter;
+
+  while (1) {
+    // 새 GGA 대기 (keepalive 주기마다 한 번은 깨어남)
+    bool is_new = (xQueueReceive(g_gga_mailbox, &gga,
+                                 pdMS_TO_TICKS(NTRIP_GGA_KEEPALIVE_MS)) == pdTRUE);
+
+    if (!is_new && gga.len == 0) {
+      continue; // 아직 보낼 GGA 없음
+    }
+
+    // 전송 간격 제한: 대기하는 동안 들어온 GGA가 있으면 최신 것으로 교체
+    TickType_t elapsed = xTaskGetTickCount() - last_send;
+    if (last_send != 0 && elapsed < pdMS_TO_TICKS(NTRIP_GGA_MIN_INTERVAL_MS)) {
+      vTaskDelay(pdMS_TO_TICKS(NTRIP_GGA_MIN_INTERVAL_MS) - elapsed);
+      xQueueReceive(g_gga_mailbox, &gga, 0);
+    }
+
+    tcp_socket_t *sock = ntrip_get_socket();
+    if (!sock) {
+      continue; // 연결 전 또는 재연결 중
+    }
+
+    int send_ret = tcp_send(sock, (const uint8_t *)gga.data, gga.len);
+    last_send = xTaskGetTickCount();
+
+    if (send_ret > 0) {
+      LOG_DEBUG("GGA→NTRIP%s (%d bytes): %.*s", is_new ? "" : " (keepalive)",
+                send_ret, gga.len - 2, gga.data);
+    } else {
+      LOG_WARN("GGA 전송 실패: %d", send_ret);
+    }
+  }
+}
+
 void ntrip_task_create(gsm_t *gsm) {
+  g_gga_mailbox = xQueueCreate(1, sizeof(ntrip_gga_msg_t));
+
   xTaskCreate(ntrip_tcp_recv_task, "ntrip_recv", 2048, gsm,
               tskIDLE_PRIORITY + 3, NULL);
+  xTaskCreate(ntrip_uplink_task, "ntrip_gga", 1024, NULL,
+              tskIDLE_PRIORITY + 2, NULL);
 }
@@ -18,4 +18,15 @@ void ntrip_task_create(gsm_t *gsm);
  */
 tcp_socket_t* ntrip_get_socket(void);
 
+/**
+ * @brief 최신 GGA를 NTRIP 업링크로 전달 (논블로킹)
+ *
+ * 길이 1 메일박스에 덮어쓰기만 하고 바로 반환한다.
+ * 실제 전송은 NTRIP 업링크 태스크가 주기 제한을 두고 수행.
+ *
+ * @param gga GGA 문장 (\r\n 포함)
+ * @param len 길이
+ */
+void ntrip_post_gga(const char *gga, uint8_t len);
+
 #endif // NTRIP_TASK_H
\ No newline at end of file
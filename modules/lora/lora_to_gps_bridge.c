@@ -113,7 +113,7 @@ bool lora_gps_bridge_init(gps_id_t gps_id) {
   // Create queue
   g_bridge_ctx.packet_queue = xQueueCreate(LORA_GPS_QUEUE_SIZE, sizeof(lora_gps_packet_t));
   if (!g_bridge_ctx.packet_queue) {
-    LOG_ERROR("Failed to create packet queue");
+    LOG_ERR("Failed to create packet queue");
     return false;
   }
 
@@ -122,7 +122,7 @@ bool lora_gps_bridge_init(gps_id_t gps_id) {
   g_bridge_ctx.pool_mutex = xSemaphoreCreateMutex();
 
   if (!g_bridge_ctx.stats_mutex || !g_bridge_ctx.pool_mutex) {
-    LOG_ERROR("Failed to create mutexes");
+    LOG_ERR("Failed to create mutexes");
     lora_gps_bridge_deinit();
     return false;
   }
@@ -143,7 +143,7 @@ bool lora_gps_bridge_init(gps_id_t gps_id) {
   );
 
   if (result != pdPASS) {
-    LOG_ERROR("Failed to create forwarding task");
+    LOG_ERR("Failed to create forwarding task");
     lora_gps_bridge_deinit();
     return false;
   }
@@ -247,7 +247,7 @@ static void lora_gps_forward_task(void *param) {
     // Wait for packet
     if (xQueueReceive(g_bridge_ctx.packet_queue, &packet, portMAX_DELAY) == pdTRUE) {
       if (!packet.data || packet.len == 0) {
-        LOG_ERROR("Invalid packet received");
+        LOG_ERR("Invalid packet received");
         continue;
       }
 
@@ -267,7 +267,7 @@ static void lora_gps_forward_task(void *param) {
 
         LOG_DEBUG("Forwarded %u bytes to GPS[%d]", packet.len, g_bridge_ctx.gps_id);
       } else {
-        LOG_ERROR("Failed to send to GPS[%d]", g_bridge_ctx.gps_id);
+        LOG_ERR("Failed to send to GPS[%d]", g_bridge_ctx.gps_id);
       }
 
       // Free buffer
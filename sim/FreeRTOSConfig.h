@@ -0,0 +1,66 @@
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/**
+ * @brief 호스트 시뮬레이션용 FreeRTOS 설정 (POSIX 포트)
+ *
+ * config/FreeRTOSConfig.h 와 태스크/큐/타이머 관련 값은 동일하게 맞추고,
+ * Cortex-M 전용 항목(NVIC 우선순위, SystemView, MPU)만 제외했다.
+ * 스택 크기는 pthread 최소 스택 이상이어야 하므로 별도 값 사용.
+ */
+
+#include <limits.h>
+#include <stdint.h>
+
+#define configUSE_PREEMPTION 1
+#define configSUPPORT_STATIC_ALLOCATION 0
+#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#define configUSE_IDLE_HOOK 0
+#define configUSE_TICK_HOOK 0
+#define configUSE_TICKLESS_IDLE 0
+#define configTICK_RATE_HZ ((TickType_t)1000)
+#define configMAX_PRIORITIES (56)
+#define configMINIMAL_STACK_SIZE ((uint16_t)PTHREAD_STACK_MIN)
+#define configTOTAL_HEAP_SIZE ((size_t)(16 * 1024 * 1024))
+#define configMAX_TASK_NAME_LEN (16)
+#define configUSE_TRACE_FACILITY 1
+#define configUSE_16_BIT_TICKS 0
+#define configIDLE_SHOULD_YIELD 1
+#define configUSE_MUTEXES 1
+#define configQUEUE_REGISTRY_SIZE 8
+#define configUSE_RECURSIVE_MUTEXES 1
+#define configUSE_APPLICATION_TASK_TAG 1
+#define configUSE_COUNTING_SEMAPHORES 1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_MALLOC_FAILED_HOOK 1
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configGENERATE_RUN_TIME_STATS 0
+#define configMESSAGE_BUFFER_LENGTH_TYPE size_t
+
+/* Software timer definitions. */
+#define configUSE_TIMERS 1
+#define configTIMER_TASK_PRIORITY (10)
+#define configTIMER_QUEUE_LENGTH 10
+#define configTIMER_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+
+#define INCLUDE_vTaskPrioritySet 1
+#define INCLUDE_uxTaskPriorityGet 1
+#define INCLUDE_vTaskDelete 1
+#define INCLUDE_vTaskCleanUpResources 0
+#define INCLUDE_vTaskSuspend 1
+#define INCLUDE_vTaskDelayUntil 1
+#define INCLUDE_vTaskDelay 1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTimerPendFunctionCall 1
+#define INCLUDE_xQueueGetMutexHolder 1
+#define INCLUDE_uxTaskGetStackHighWaterMark 1
+#define INCLUDE_eTaskGetState 1
+#define INCLUDE_xTaskGetIdleTaskHandle 1
+
+void vAssertCalled(const char *file, int line);
+#define configASSERT(x)                                                        \
+  if ((x) == 0) {                                                              \
+    vAssertCalled(__FILE__, __LINE__);                                         \
+  }
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,7 @@
+#ifndef SIM_STM32F4XX_H
+#define SIM_STM32F4XX_H
+
+// 호스트 시뮬레이션: 디바이스 헤더 대신 HAL 대체 헤더 사용
+#include "stm32f4xx_hal.h"
+
+#endif /* SIM_STM32F4XX_H */
@@ -0,0 +1,7 @@
+#ifndef SIM_STM32F4XX_HAL_GPIO_H
+#define SIM_STM32F4XX_HAL_GPIO_H
+
+// 호스트 시뮬레이션: GPIO 정의는 stm32f4xx_hal.h 대체 헤더에 포함
+#include "stm32f4xx_hal.h"
+
+#endif /* SIM_STM32F4XX_HAL_GPIO_H */
@@ -0,0 +1,16 @@
+#ifndef SIM_USART_H
+#define SIM_USART_H
+
+#include "stm32f4xx_hal.h"
+
+/**
+ * @brief 호스트 시뮬레이션용 UART 핸들
+ *
+ * Core/Inc/usart.h 대체. LoRa 등 HAL UART를 직접 쓰는 모듈에서 사용.
+ */
+extern UART_HandleTypeDef huart2;
+extern UART_HandleTypeDef huart3;
+extern UART_HandleTypeDef huart4;
+extern UART_HandleTypeDef huart5;
+
+#endif /* SIM_USART_H */
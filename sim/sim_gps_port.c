@@ -0,0 +1,137 @@
+#include "gps_port.h"
+#include "gps_config.h"
+#include "sim_uart.h"
+
+#ifndef TAG
+  #define TAG "GPS_PORT"
+#endif
+
+#include "log.h"
+
+/**
+ * @brief GPS 포트 호스트 구현 (modules/gps/gps_port.c 대체)
+ *
+ * USART2 DMA 순환 버퍼 대신 sim_uart가 파일/파이프 입력을 채우고,
+ * 누적 수신 바이트 수를 태스크 알림으로 전달한다.
+ * gps_app.c는 수정 없이 그대로 동작한다.
+ */
+
+static char gps_recv_buf[GPS_CNT][GPS_UART2_RX_BUF_SIZE];
+static TaskHandle_t gps_tasks[GPS_CNT] = {NULL};
+
+static sim_uart_t gps_uarts[GPS_CNT];
+static const char *gps_rx_path[GPS_CNT];
+static const char *gps_tx_path[GPS_CNT];
+
+/**
+ * @brief 시뮬레이션 입출력 경로 설정 (sim_main.c에서 호출)
+ */
+void sim_gps_port_set_path(gps_id_t id, const char *rx_path,
+                           const char *tx_path) {
+  if (id < GPS_CNT) {
+    gps_rx_path[id] = rx_path;
+    gps_tx_path[id] = tx_path;
+  }
+}
+
+static int sim_gps_init(gps_id_t id) {
+  sim_uart_t *uart = &gps_uarts[id];
+
+  uart->name = (id == GPS_ID_BASE) ? "sim_gps0" : "sim_gps1";
+  uart->rx_buf = gps_recv_buf[id];
+  uart->rx_size = sizeof(gps_recv_buf[id]);
+  uart->notify_task = &gps_tasks[id];
+
+  return sim_uart_open(uart, gps_rx_path[id], gps_tx_path[id]);
+}
+
+static int sim_gps0_init(void) { return sim_gps_init(GPS_ID_BASE); }
+static int sim_gps0_start(void) {
+  sim_uart_start(&gps_uarts[GPS_ID_BASE]);
+  return 0;
+}
+static int sim_gps0_reset(void) { return 0; }
+static int sim_gps0_send(const char *data, size_t len) {
+  return sim_uart_send(&gps_uarts[GPS_ID_BASE], data, len);
+}
+
+static int sim_gps0_set_baud(uint32_t baud) {
+  // 파일/파이프 입력에는 보레이트가 없으므로 기록만 남김
+  LOG_INFO("GPS[0] 시뮬레이션 보레이트 %u", (unsigned)baud);
+  return 0;
+}
+
+static const gps_hal_ops_t sim_gps0_ops = {
+  .init = sim_gps0_init,
+  .reset = sim_gps0_reset,
+  .start = sim_gps0_start,
+  .stop = NULL,
+  .send = sim_gps0_send,
+  .send_async = sim_gps0_send,
+  .recv = NULL,
+  .set_baud = sim_gps0_set_baud,
+};
+
+int gps_port_init_instance(gps_t* gps_handle, gps_id_t id, gps_type_t type) {
+  if (id >= GPS_CNT) return -1;
+
+  LOG_INFO("GPS[%d] 시뮬레이션 포트 (GPS 타입: %s, 입력: %s)", id,
+           type == GPS_TYPE_F9P ? "F9P" : "UM982",
+           gps_rx_path[id] ? gps_rx_path[id] : "없음");
+
+  // 보드 구성상 GPS_CNT는 최대 1 (USART2)
+  gps_handle->ops = &sim_gps0_ops;
+  if (gps_handle->ops->init && gps_handle->ops->init() != 0) {
+    return -1;
+  }
+
+  return 0;
+}
+
+void gps_port_start(gps_t* gps_handle) {
+  if (!gps_handle || !gps_handle->ops || !gps_handle->ops->start) {
+    LOG_ERR("GPS start failed: invalid handle or ops");
+    return;
+  }
+
+  gps_handle->ops->start();
+}
+
+void gps_port_stop(gps_t* gps_handle) {
+  if (!gps_handle || !gps_handle->ops || !gps_handle->ops->stop) {
+    LOG_ERR("GPS stop failed: invalid handle or ops");
+    return;
+  }
+
+  gps_handle->ops->stop();
+}
+
+int gps_port_set_baud(gps_t* gps_handle, uint32_t baud) {
+  if (!gps_handle || !gps_handle->ops || !gps_handle->ops->set_baud) {
+    LOG_ERR("GPS set baud failed: invalid handle or ops");
+    return -1;
+  }
+
+  return gps_handle->ops->set_baud(baud);
+}
+
+uint32_t gps_port_get_rx_pos(gps_id_t id) {
+  if (id >= GPS_CNT) return 0;
+  return (uint32_t)gps_uarts[id].rx_pos;
+}
+
+char* gps_port_get_recv_buf(gps_id_t id) {
+  if (id >= GPS_CNT) return NULL;
+  return gps_recv_buf[id];
+}
+
+size_t gps_port_get_recv_buf_size(gps_id_t id) {
+  if (id >= GPS_CNT) return 0;
+  return sizeof(gps_recv_buf[id]);
+}
+
+void gps_port_set_task(gps_id_t id, TaskHandle_t task) {
+  if (id < GPS_CNT) {
+    gps_tasks[id] = task;
+  }
+}
@@ -0,0 +1,58 @@
+#include "gsm_port.h"
+#include "sim_uart.h"
+
+/**
+ * @brief GSM 포트 호스트 구현 (modules/gsm/gsm_port.c 대체)
+ *
+ * USART1 DMA 순환 버퍼(gsm_mem) 대신 sim_uart가 파일/파이프 입력을 채운다.
+ * 모뎀 응답 스크립트나 실제 EC25 pty를 rx 경로로 넘기면 된다.
+ */
+
+extern char gsm_mem[2048];
+
+static sim_uart_t gsm_uart = {.name = "sim_gsm"};
+static const char *gsm_rx_path;
+static const char *gsm_tx_path;
+
+/**
+ * @brief 시뮬레이션 입출력 경로 설정 (sim_main.c에서 호출)
+ */
+void sim_gsm_port_set_path(const char *rx_path, const char *tx_path) {
+  gsm_rx_path = rx_path;
+  gsm_tx_path = tx_path;
+}
+
+void gsm_dma_init(void) {}
+
+void gsm_uart_init(void) {
+  gsm_uart.rx_buf = gsm_mem;
+  gsm_uart.rx_size = sizeof(gsm_mem);
+  gsm_uart.notify = &gsm_queue;
+  sim_uart_open(&gsm_uart, gsm_rx_path, gsm_tx_path);
+}
+
+void gsm_port_comm_start(void) { sim_uart_start(&gsm_uart); }
+
+void gsm_port_gpio_start(void) {}
+
+uint32_t gsm_get_rx_pos(void) { return (uint32_t)gsm_uart.rx_pos; }
+
+void gsm_port_init(void) {
+  gsm_dma_init();
+  gsm_uart_init();
+}
+
+void gsm_start(void) {
+  gsm_port_comm_start();
+  gsm_port_gpio_start();
+}
+
+int gsm_port_reset(void) { return 0; }
+
+int gsm_uart_send(const char *data, size_t len) {
+  return sim_uart_send(&gsm_uart, data, len);
+}
+
+int gsm_uart_send_async(const char *data, size_t len) {
+  return sim_uart_send(&gsm_uart, data, len);
+}
@@ -0,0 +1,60 @@
+#include "stm32f4xx_hal.h"
+#include "usart.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "sim_uart.h"
+#include <unistd.h>
+
+/**
+ * @brief 호스트 시뮬레이션용 HAL 구현
+ *
+ * GPIO는 상태만 저장하고, UART는 sim_uart로 연결한다.
+ */
+
+GPIO_TypeDef sim_gpioa, sim_gpiob, sim_gpioc;
+
+UART_HandleTypeDef huart2;
+UART_HandleTypeDef huart3;
+UART_HandleTypeDef huart4;
+UART_HandleTypeDef huart5;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state) {
+  if (state == GPIO_PIN_SET) {
+    port->odr |= pin;
+  } else {
+    port->odr &= ~(uint32_t)pin;
+  }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *port, uint16_t pin) { port->odr ^= pin; }
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *port, uint16_t pin) {
+  return (port->odr & pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit(UART_HandleTypeDef *huart,
+                                    const uint8_t *data, uint16_t size,
+                                    uint32_t timeout) {
+  (void)timeout;
+
+  if (!huart) {
+    return HAL_ERROR;
+  }
+
+  return sim_uart_send(huart->sim, data, size) == 0 ? HAL_OK : HAL_ERROR;
+}
+
+uint32_t HAL_GetTick(void) {
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+    return 0;
+  }
+  return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+void HAL_Delay(uint32_t delay) {
+  if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+    usleep(delay * 1000U);
+    return;
+  }
+  vTaskDelay(pdMS_TO_TICKS(delay));
+}
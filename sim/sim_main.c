@@ -0,0 +1,147 @@
+#include "FreeRTOS.h"
+#include "task.h"
+#include "gps_app.h"
+#include "gsm_app.h"
+#include "led.h"
+#include "log.h"
+#include "sim_uart.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief 호스트 시뮬레이션 진입점
+ *
+ * 실제 보드의 main.c initThread와 동일한 순서로 앱을 띄운다.
+ * UART는 파일/FIFO/pty로 대체되며 sim_gps_port.c, sim_gsm_port.c 참고.
+ *
+ * 예) GPS 로그 재생:
+ *   ./gugu_sim -g f9p_capture.bin -G gps_tx.bin -b 115200 -t 30
+ */
+
+void sim_gps_port_set_path(gps_id_t id, const char *rx_path,
+                           const char *tx_path);
+void sim_gsm_port_set_path(const char *rx_path, const char *tx_path);
+
+static uint32_t sim_duration_s = 0;
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [-g gps_rx] [-G gps_tx] [-m gsm_rx] [-M gsm_tx]\n"
+          "          [-b baud] [-t seconds]\n"
+          "  -g/-m  입력 경로 (파일, FIFO, pty)\n"
+          "  -G/-M  출력 경로 (\"-\" = stdout)\n"
+          "  -b     입력 속도 제한 (0 = 무제한, 기본 115200)\n"
+          "  -t     실행 시간 (0 = 입력 EOF까지)\n",
+          prog);
+}
+
+/**
+ * @brief 로그 출력 백엔드 (보드의 RTT/USART6 대신 stdout)
+ */
+static int sim_log_output(const char *data, size_t len) {
+  return (int)fwrite(data, 1, len, stdout);
+}
+
+static void init_task(void *pvParameter) {
+  (void)pvParameter;
+
+  led_init();
+  gps_init_all();
+  gsm_task_create(NULL);
+
+  vTaskDelete(NULL);
+}
+
+/**
+ * @brief 종료 조건 감시 태스크
+ *
+ * 실행 시간이 지나거나 모든 입력 파일이 EOF에 도달하면 통계를 출력하고 종료
+ */
+static void monitor_task(void *pvParameter) {
+  (void)pvParameter;
+  TickType_t start = xTaskGetTickCount();
+
+  while (1) {
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    TickType_t elapsed = xTaskGetTickCount() - start;
+    if (sim_duration_s > 0 && elapsed >= pdMS_TO_TICKS(sim_duration_s * 1000U)) {
+      break;
+    }
+
+    if (sim_duration_s == 0 && sim_uart_all_eof()) {
+      // 마지막 수신분을 앱 태스크가 처리할 시간
+      vTaskDelay(pdMS_TO_TICKS(500));
+      break;
+    }
+  }
+
+  log_flush();
+  fflush(stdout);
+  sim_uart_print_stats();
+  fflush(stdout);
+  exit(0);
+}
+
+int main(int argc, char *argv[]) {
+  const char *gps_rx = NULL, *gps_tx = NULL;
+  const char *gsm_rx = NULL, *gsm_tx = NULL;
+  uint32_t baud = 115200;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "g:G:m:M:b:t:h")) != -1) {
+    switch (opt) {
+    case 'g':
+      gps_rx = optarg;
+      break;
+    case 'G':
+      gps_tx = optarg;
+      break;
+    case 'm':
+      gsm_rx = optarg;
+      break;
+    case 'M':
+      gsm_tx = optarg;
+      break;
+    case 'b':
+      baud = (uint32_t)strtoul(optarg, NULL, 10);
+      break;
+    case 't':
+      sim_duration_s = (uint32_t)strtoul(optarg, NULL, 10);
+      break;
+    default:
+      usage(argv[0]);
+      return 1;
+    }
+  }
+
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  sim_uart_set_default_baud(baud);
+  sim_gps_port_set_path(GPS_ID_BASE, gps_rx, gps_tx);
+  sim_gsm_port_set_path(gsm_rx, gsm_tx);
+
+  log_set_output(sim_log_output);
+  log_init();
+
+  xTaskCreate(init_task, "init", configMINIMAL_STACK_SIZE * 4, NULL,
+              tskIDLE_PRIORITY + 1, NULL);
+  xTaskCreate(monitor_task, "sim_mon", configMINIMAL_STACK_SIZE * 2, NULL,
+              tskIDLE_PRIORITY + 1, NULL);
+
+  vTaskStartScheduler();
+
+  return 0;
+}
+
+/* FreeRTOS 훅 ----------------------------------------------------------------*/
+void vApplicationMallocFailedHook(void) {
+  fprintf(stderr, "[SIM] malloc failed\n");
+  abort();
+}
+
+void vAssertCalled(const char *file, int line) {
+  fprintf(stderr, "[SIM] ASSERT %s:%d\n", file, line);
+  abort();
+}
@@ -0,0 +1,188 @@
+#include "sim_uart.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SIM_UART_MAX 4
+#define SIM_UART_POLL_TICKS 1     ///< RX 폴링 주기 (tick)
+#define SIM_UART_UNTHROTTLED 1024 ///< 속도 제한 없을 때 한 번에 읽는 최대 크기
+
+static sim_uart_t *uarts[SIM_UART_MAX];
+static size_t uart_cnt = 0;
+static uint32_t default_baud = 0;
+
+void sim_uart_set_default_baud(uint32_t baud) { default_baud = baud; }
+
+int sim_uart_open(sim_uart_t *uart, const char *rx_path, const char *tx_path) {
+  uart->rx_fd = -1;
+  uart->tx_fd = -1;
+  uart->rx_pos = 0;
+  uart->rx_total = 0;
+  uart->tx_total = 0;
+  uart->rx_eof = (rx_path == NULL);
+  if (uart->baud == 0) {
+    uart->baud = default_baud;
+  }
+
+  if (rx_path) {
+    // FIFO는 writer가 붙을 때까지 막히지 않도록 O_NONBLOCK으로 연다
+    uart->rx_fd = open(rx_path, O_RDONLY | O_NONBLOCK);
+    if (uart->rx_fd < 0) {
+      fprintf(stderr, "[SIM] %s: RX 열기 실패 %s (%s)\n", uart->name, rx_path,
+              strerror(errno));
+      return -1;
+    }
+  }
+
+  if (tx_path) {
+    if (strcmp(tx_path, "-") == 0) {
+      uart->tx_fd = STDOUT_FILENO;
+    } else {
+      uart->tx_fd = open(tx_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (uart->tx_fd < 0) {
+        fprintf(stderr, "[SIM] %s: TX 열기 실패 %s (%s)\n", uart->name,
+                tx_path, strerror(errno));
+        return -1;
+      }
+    }
+  }
+
+  if (uart_cnt < SIM_UART_MAX) {
+    uarts[uart_cnt++] = uart;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief 순환 버퍼에 쓰기 (DMA 전송 대응)
+ */
+static void sim_uart_rx_push(sim_uart_t *uart, const uint8_t *data,
+                             size_t len) {
+  size_t pos = uart->rx_pos;
+
+  while (len > 0) {
+    size_t n = uart->rx_size - pos;
+    if (n > len) {
+      n = len;
+    }
+
+    memcpy(&uart->rx_buf[pos], data, n);
+    data += n;
+    len -= n;
+    pos += n;
+    if (pos == uart->rx_size) {
+      pos = 0;
+    }
+  }
+
+  uart->rx_pos = pos;
+}
+
+/**
+ * @brief RX 폴링 태스크
+ *
+ * 설정된 baud에 맞춰 tick당 읽는 양을 제한한다.
+ * (블로킹 read는 POSIX 포트 스케줄러를 멈추므로 논블로킹 + vTaskDelay)
+ */
+static void sim_uart_rx_task(void *param) {
+  sim_uart_t *uart = (sim_uart_t *)param;
+  uint8_t buf[SIM_UART_UNTHROTTLED];
+  size_t chunk = SIM_UART_UNTHROTTLED;
+  struct stat st;
+  bool is_regular = (fstat(uart->rx_fd, &st) == 0 && S_ISREG(st.st_mode));
+
+  if (uart->baud > 0) {
+    // 8N1 = 10 bit/byte
+    chunk = (uart->baud / 10U) * SIM_UART_POLL_TICKS / configTICK_RATE_HZ;
+    if (chunk == 0) {
+      chunk = 1;
+    }
+    if (chunk > sizeof(buf)) {
+      chunk = sizeof(buf);
+    }
+  }
+
+  // 순환 버퍼를 한 번에 절반 이상 채우지 않음 (앱 태스크가 따라올 여유)
+  if (chunk > uart->rx_size / 2) {
+    chunk = uart->rx_size / 2;
+  }
+
+  while (1) {
+    ssize_t n = read(uart->rx_fd, buf, chunk);
+
+    if (n > 0) {
+      sim_uart_rx_push(uart, buf, (size_t)n);
+      uart->rx_total += (uint64_t)n;
+
+      // IDLE IRQ 대응: 앱 태스크 깨우기
+      if (uart->notify && *uart->notify) {
+        uint8_t dummy = 0;
+        xQueueSend(*uart->notify, &dummy, 0);
+      }
+      if (uart->notify_task && *uart->notify_task) {
+        xTaskNotify(*uart->notify_task, (uint32_t)uart->rx_total,
+                    eSetValueWithOverwrite);
+      }
+    } else if (n == 0 && is_regular) {
+      // 로그 재생 종료
+      uart->rx_eof = true;
+      break;
+    }
+
+    vTaskDelay(SIM_UART_POLL_TICKS);
+  }
+
+  vTaskDelete(NULL);
+}
+
+void sim_uart_start(sim_uart_t *uart) {
+  if (!uart || uart->rx_fd < 0) {
+    return;
+  }
+
+  xTaskCreate(sim_uart_rx_task, uart->name, configMINIMAL_STACK_SIZE * 4, uart,
+              configMAX_PRIORITIES - 1, NULL);
+}
+
+int sim_uart_send(sim_uart_t *uart, const void *data, size_t len) {
+  if (!uart || uart->tx_fd < 0) {
+    return 0;
+  }
+
+  const uint8_t *p = (const uint8_t *)data;
+  while (len > 0) {
+    ssize_t n = write(uart->tx_fd, p, len);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    p += n;
+    len -= (size_t)n;
+    uart->tx_total += (uint64_t)n;
+  }
+
+  return 0;
+}
+
+bool sim_uart_all_eof(void) {
+  for (size_t i = 0; i < uart_cnt; i++) {
+    if (!uarts[i]->rx_eof) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void sim_uart_print_stats(void) {
+  for (size_t i = 0; i < uart_cnt; i++) {
+    printf("[SIM] %-8s rx=%llu tx=%llu\n", uarts[i]->name,
+           (unsigned long long)uarts[i]->rx_total,
+           (unsigned long long)uarts[i]->tx_total);
+  }
+}
@@ -0,0 +1,75 @@
+#ifndef SIM_UART_H
+#define SIM_UART_H
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief 파일/파이프 기반 UART 에뮬레이션
+ *
+ * 실제 보드의 "DMA 순환 버퍼 + IDLE 인터럽트" 구조를 그대로 흉내낸다.
+ * - RX: rx_fd에서 읽은 바이트를 rx_buf(순환)에 쓰고 rx_pos를 전진시킨 뒤
+ *       notify 큐에 더미 바이트를 넣거나(GSM), notify_task에 누적 수신
+ *       바이트 수를 알린다(GPS, DMA HT/TC/IDLE 대응)
+ * - TX: tx_fd에 그대로 write (없으면 버림)
+ *
+ * rx_fd는 일반 파일(로그 재생), FIFO(mkfifo), pty 등 무엇이든 가능.
+ */
+typedef struct sim_uart_s {
+  const char *name;
+
+  int rx_fd; ///< 입력 fd (-1이면 수신 없음)
+  int tx_fd; ///< 출력 fd (-1이면 버림)
+
+  char *rx_buf;             ///< DMA 순환 버퍼 대응
+  size_t rx_size;           ///< rx_buf 크기
+  volatile size_t rx_pos;   ///< 다음 쓰기 위치 (size - NDTR 대응)
+  QueueHandle_t *notify;    ///< IDLE 알림 큐 (포트 쪽 큐 변수 주소)
+  TaskHandle_t *notify_task; ///< 누적 위치 알림 태스크 (포트 쪽 변수 주소)
+  uint32_t baud;            ///< 전송 속도 제한 (0=무제한)
+
+  uint64_t rx_total; ///< 누적 수신 바이트
+  uint64_t tx_total; ///< 누적 송신 바이트
+  bool rx_eof;       ///< 일반 파일 입력을 끝까지 읽음
+} sim_uart_t;
+
+/**
+ * @brief 입출력 경로 열기
+ *
+ * @param uart UART 핸들
+ * @param rx_path 입력 경로 (NULL이면 수신 없음)
+ * @param tx_path 출력 경로 (NULL이면 버림, "-"이면 stdout)
+ * @return int 0: 성공, -1: 실패
+ */
+int sim_uart_open(sim_uart_t *uart, const char *rx_path, const char *tx_path);
+
+/**
+ * @brief RX 폴링 태스크 시작 (포트 start ops에서 호출)
+ */
+void sim_uart_start(sim_uart_t *uart);
+
+/**
+ * @brief 데이터 송신
+ */
+int sim_uart_send(sim_uart_t *uart, const void *data, size_t len);
+
+/**
+ * @brief 전체 UART RX가 끝났는지 (모든 일반 파일 입력 EOF)
+ */
+bool sim_uart_all_eof(void);
+
+/**
+ * @brief 모든 UART 통계 출력
+ */
+void sim_uart_print_stats(void);
+
+/**
+ * @brief 기본 전송 속도 설정 (sim_uart_open 이전에 호출)
+ */
+void sim_uart_set_default_baud(uint32_t baud);
+
+#endif /* SIM_UART_H */
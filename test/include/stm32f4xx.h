@@ -0,0 +1,52 @@
+#ifndef TEST_STM32F4XX_H
+#define TEST_STM32F4XX_H
+
+/**
+ * @brief 호스트 단위 테스트용 디바이스 헤더 대체
+ *
+ * uart_tx.c가 쓰는 DMA/USART 레지스터와 NVIC 함수만 흉내낸다.
+ * DMA 전송은 테스트 코드가 M0AR/NDTR을 읽어 직접 완료시킨다.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+  volatile uint32_t LISR;
+  volatile uint32_t HISR;
+  volatile uint32_t LIFCR;
+  volatile uint32_t HIFCR;
+
+  /* 스트림 하나만 흉내냄 */
+  volatile uint32_t M0AR;
+  volatile uint32_t NDTR;
+  volatile uint32_t EN;
+} DMA_TypeDef;
+
+typedef struct {
+  volatile uint32_t SR;
+  volatile uint32_t DR;
+} USART_TypeDef;
+
+typedef int IRQn_Type;
+
+extern DMA_TypeDef test_dma1, test_dma2;
+#define DMA1 (&test_dma1)
+#define DMA2 (&test_dma2)
+
+static inline void NVIC_SetPriority(IRQn_Type irqn, uint32_t prio) {
+  (void)irqn;
+  (void)prio;
+}
+
+static inline uint32_t NVIC_GetPriorityGrouping(void) { return 0; }
+
+static inline uint32_t NVIC_EncodePriority(uint32_t group, uint32_t pre,
+                                           uint32_t sub) {
+  (void)group;
+  (void)sub;
+  return pre;
+}
+
+static inline void NVIC_EnableIRQ(IRQn_Type irqn) { (void)irqn; }
+
+#endif /* TEST_STM32F4XX_H */
@@ -0,0 +1,11 @@
+#ifndef TEST_STM32F4XX_LL_BUS_H
+#define TEST_STM32F4XX_LL_BUS_H
+
+#include "stm32f4xx.h"
+
+#define LL_AHB1_GRP1_PERIPH_DMA1 (1u << 21)
+#define LL_AHB1_GRP1_PERIPH_DMA2 (1u << 22)
+
+static inline void LL_AHB1_GRP1_EnableClock(uint32_t periph) { (void)periph; }
+
+#endif /* TEST_STM32F4XX_LL_BUS_H */
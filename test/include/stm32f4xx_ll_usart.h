@@ -0,0 +1,20 @@
+#ifndef TEST_STM32F4XX_LL_USART_H
+#define TEST_STM32F4XX_LL_USART_H
+
+#include "stm32f4xx.h"
+
+#define USART_SR_TC (1u << 6)
+
+static inline void LL_USART_ClearFlag_TC(USART_TypeDef *uart) {
+  uart->SR &= ~USART_SR_TC;
+}
+
+static inline uint32_t LL_USART_IsActiveFlag_TC(USART_TypeDef *uart) {
+  return (uart->SR & USART_SR_TC) ? 1u : 0u;
+}
+
+static inline void LL_USART_EnableDMAReq_TX(USART_TypeDef *uart) {
+  (void)uart;
+}
+
+#endif /* TEST_STM32F4XX_LL_USART_H */
@@ -0,0 +1,310 @@
+/**
+ * @file test_rtcm.c
+ * @brief RTCM 프레임 파서 / CRC24Q 검증
+ *
+ * rtcm_crc24()를 비트 단위 CRC24Q와 비교하고, 같은 바이트열을
+ * rtcm_parse_byte()와 rtcm_parse_block()(여러 조각 크기)으로 넣어
+ * 프레임 경계와 CRC 판정이 같은지 본다. 페이로드 0 바이트 프레임을 포함한다.
+ */
+#include "rtcm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_CRC_ITER 2000
+#define TEST_MAX_FRAMES 8
+
+static int fail_cnt;
+
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);                              \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+      fail_cnt++;                                                              \
+    }                                                                          \
+  } while (0)
+
+/* 재현 가능한 난수 (xorshift32) */
+static uint32_t rng_state = 0x9E3779B9;
+
+static uint32_t rng(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static uint32_t ref_crc24q(const uint8_t *buf, size_t len) {
+  uint32_t crc = 0;
+
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint32_t)buf[i] << 16;
+    for (int b = 0; b < 8; b++) {
+      crc <<= 1;
+      if (crc & 0x1000000) {
+        crc ^= 0x1864CFB;
+      }
+    }
+  }
+  return crc & 0xFFFFFF;
+}
+
+/**
+ * @brief 페이로드로 RTCM 프레임 만들기
+ *
+ * @return 프레임 전체 길이
+ */
+static size_t make_frame(uint8_t *out, const uint8_t *payload, size_t len) {
+  uint32_t crc;
+
+  out[0] = 0xD3;
+  out[1] = (uint8_t)((len >> 8) & 0x03);
+  out[2] = (uint8_t)(len & 0xFF);
+  if (len) {
+    memcpy(&out[3], payload, len);
+  }
+
+  crc = ref_crc24q(out, 3 + len);
+  out[3 + len] = (uint8_t)(crc >> 16);
+  out[4 + len] = (uint8_t)(crc >> 8);
+  out[5 + len] = (uint8_t)crc;
+
+  return len + 6;
+}
+
+/* 파싱 결과 */
+typedef struct {
+  size_t cnt;
+  uint16_t len[TEST_MAX_FRAMES];
+  uint16_t type[TEST_MAX_FRAMES];
+  uint32_t errors;
+} parse_result_t;
+
+static void collect(rtcm_parser_t *parser, parse_result_t *res) {
+  const uint8_t *data;
+  uint16_t len;
+
+  rtcm_get_packet(parser, &data, &len);
+  if (data && res->cnt < TEST_MAX_FRAMES) {
+    res->len[res->cnt] = len;
+    res->type[res->cnt] = parser->current_packet.message_type;
+    res->cnt++;
+  }
+}
+
+/* 파서가 쥐고 있는 프레임을 풀에 돌려줌 (테스트마다 새 파서를 쓰므로) */
+static void parser_release(rtcm_parser_t *parser) {
+  if (parser->current_packet.frame) {
+    rtcm_frame_unref(parser->current_packet.frame);
+    parser->current_packet.frame = NULL;
+  }
+}
+
+static void parse_bytes(const uint8_t *buf, size_t len, parse_result_t *res) {
+  rtcm_parser_t parser;
+
+  memset(res, 0, sizeof(*res));
+  rtcm_parser_init(&parser);
+
+  for (size_t i = 0; i < len; i++) {
+    if (rtcm_parse_byte(&parser, buf[i])) {
+      collect(&parser, res);
+    }
+  }
+
+  res->errors = parser.error_count;
+  parser_release(&parser);
+}
+
+static void parse_blocks(const uint8_t *buf, size_t len, size_t chunk,
+                         parse_result_t *res) {
+  rtcm_parser_t parser;
+  size_t pos = 0;
+
+  memset(res, 0, sizeof(*res));
+  rtcm_parser_init(&parser);
+
+  while (pos < len) {
+    size_t end = (pos + chunk < len) ? pos + chunk : len;
+
+    // 조각 하나를 다 먹을 때까지 (프레임 완료 시 중간에 반환됨)
+    while (pos < end) {
+      size_t consumed = 0;
+
+      if (rtcm_parse_block(&parser, &buf[pos], end - pos, &consumed)) {
+        collect(&parser, res);
+      }
+      pos += consumed;
+    }
+  }
+
+  res->errors = parser.error_count;
+  parser_release(&parser);
+}
+
+static void check_same(const parse_result_t *a, const parse_result_t *b,
+                       const char *what) {
+  CHECK(a->cnt == b->cnt, "%s: %u vs %u frames", what, (unsigned)a->cnt,
+        (unsigned)b->cnt);
+  CHECK(a->errors == b->errors, "%s: %u vs %u errors", what,
+        (unsigned)a->errors, (unsigned)b->errors);
+  for (size_t i = 0; i < a->cnt && i < b->cnt; i++) {
+    CHECK(a->len[i] == b->len[i] && a->type[i] == b->type[i],
+          "%s: frame %u len %u/%u type %u/%u", what, (unsigned)i, a->len[i],
+          b->len[i], a->type[i], b->type[i]);
+  }
+}
+
+/**
+ * @brief rtcm_crc24 / rtcm_crc24_update를 비트 단위 CRC24Q와 비교
+ */
+static void test_crc(void) {
+  static uint8_t buf[1030];
+
+  CHECK(rtcm_crc24(buf, 0) == 0, "crc of empty buffer");
+
+  for (int it = 0; it < TEST_CRC_ITER; it++) {
+    size_t len = rng() % sizeof(buf);
+    size_t split = len ? rng() % len : 0;
+    uint32_t ref;
+
+    for (size_t i = 0; i < len; i++) {
+      buf[i] = (uint8_t)rng();
+    }
+
+    ref = ref_crc24q(buf, len);
+    CHECK(rtcm_crc24(buf, len) == ref, "crc24 len=%u", (unsigned)len);
+    CHECK(rtcm_crc24_update(rtcm_crc24(buf, split), &buf[split],
+                            len - split) == ref,
+          "crc24_update len=%u split=%u", (unsigned)len, (unsigned)split);
+  }
+}
+
+/**
+ * @brief 페이로드 0 바이트 프레임 (바이트/블록 경로)
+ */
+static void test_empty_frame(void) {
+  static const uint8_t p1005[] = {0x3E, 0xD7, 0xD3, 0x02, 0x00, 0x00};
+  static const size_t chunks[] = {1, 2, 3, 5, 7, 64};
+  uint8_t stream[64];
+  size_t len = 0;
+  parse_result_t byte_res, block_res;
+
+  // 빈 프레임 단독: D3 00 00 + CRC
+  len = make_frame(stream, NULL, 0);
+  parse_bytes(stream, len, &byte_res);
+  CHECK(byte_res.cnt == 1 && byte_res.errors == 0,
+        "empty frame (byte): %u frames, %u errors", (unsigned)byte_res.cnt,
+        (unsigned)byte_res.errors);
+  CHECK(byte_res.len[0] == 6 && byte_res.type[0] == 0,
+        "empty frame (byte): len %u type %u", byte_res.len[0],
+        byte_res.type[0]);
+
+  // 빈 프레임 앞뒤로 일반 프레임, 사이에 잡음
+  len = make_frame(stream, p1005, sizeof(p1005));
+  len += make_frame(&stream[len], NULL, 0);
+  stream[len++] = 0x00;
+  stream[len++] = 0x55;
+  len += make_frame(&stream[len], NULL, 0);
+  len += make_frame(&stream[len], p1005, sizeof(p1005));
+
+  parse_bytes(stream, len, &byte_res);
+  CHECK(byte_res.cnt == 4 && byte_res.errors == 0,
+        "mixed stream (byte): %u frames, %u errors", (unsigned)byte_res.cnt,
+        (unsigned)byte_res.errors);
+  CHECK(byte_res.type[0] == 1005 && byte_res.type[1] == 0 &&
+            byte_res.type[2] == 0 && byte_res.type[3] == 1005,
+        "mixed stream (byte): types %u %u %u %u", byte_res.type[0],
+        byte_res.type[1], byte_res.type[2], byte_res.type[3]);
+
+  for (size_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+    char what[32];
+
+    parse_blocks(stream, len, chunks[c], &block_res);
+    snprintf(what, sizeof(what), "block chunk=%u", (unsigned)chunks[c]);
+    check_same(&byte_res, &block_res, what);
+  }
+
+  // CRC가 깨진 빈 프레임은 버림
+  len = make_frame(stream, NULL, 0);
+  stream[5] ^= 0x01;
+  parse_bytes(stream, len, &byte_res);
+  CHECK(byte_res.cnt == 0 && byte_res.errors == 1,
+        "corrupt empty frame: %u frames, %u errors", (unsigned)byte_res.cnt,
+        (unsigned)byte_res.errors);
+}
+
+/**
+ * @brief 무작위 길이 프레임열, 일부 CRC 손상 (바이트 경로 = 블록 경로)
+ */
+static void test_random_stream(void) {
+  static uint8_t stream[6 * 1100];
+  static uint8_t payload[1023];
+  size_t len = 0;
+  int expect_ok = 0, expect_bad = 0;
+  parse_result_t byte_res, block_res;
+
+  for (int f = 0; f < TEST_MAX_FRAMES - 2; f++) {
+    size_t plen = (f == 0) ? 0 : rng() % sizeof(payload);
+    size_t flen;
+
+    for (size_t i = 0; i < plen; i++) {
+      payload[i] = (uint8_t)rng();
+    }
+    if (plen >= 2) {
+      payload[0] = (uint8_t)(1077 >> 4);
+      payload[1] = (uint8_t)((1077 & 0x0F) << 4);
+    }
+
+    flen = make_frame(&stream[len], payload, plen);
+    if (f == 3) {
+      // CRC 마지막 바이트 손상: 프레임 하나만 버리고 다음 프레임부터 다시 동기
+      stream[len + flen - 1] ^= 0x80;
+      expect_bad++;
+    } else {
+      expect_ok++;
+    }
+    len += flen;
+  }
+
+  parse_bytes(stream, len, &byte_res);
+  CHECK((int)byte_res.cnt == expect_ok, "random stream: %u frames, want %d",
+        (unsigned)byte_res.cnt, expect_ok);
+  CHECK(byte_res.errors == (uint32_t)expect_bad,
+        "random stream: %u errors, want %d", (unsigned)byte_res.errors,
+        expect_bad);
+
+  for (size_t chunk = 1; chunk <= 1100; chunk = chunk * 3 + 1) {
+    char what[32];
+
+    parse_blocks(stream, len, chunk, &block_res);
+    snprintf(what, sizeof(what), "random chunk=%u", (unsigned)chunk);
+    check_same(&byte_res, &block_res, what);
+  }
+}
+
+int main(void) {
+  test_crc();
+  test_empty_frame();
+  test_random_stream();
+
+  if (fail_cnt) {
+    printf("test_rtcm: %d failure(s)\n", fail_cnt);
+    return 1;
+  }
+
+  printf("test_rtcm: OK\n");
+  return 0;
+}
+
+void vApplicationMallocFailedHook(void) {
+  fprintf(stderr, "malloc failed\n");
+  abort();
+}
+
+void vAssertCalled(const char *file, int line) {
+  fprintf(stderr, "ASSERT %s:%d\n", file, line);
+  abort();
+}
@@ -0,0 +1,215 @@
+/**
+ * @file test_uart_tx.c
+ * @brief uart_tx 대기 태스크 깨우기 검증
+ *
+ * DMA 스트림과 완료 인터럽트를 가장 높은 우선순위 태스크로 흉내낸다.
+ * 링이 가득 차 uart_tx_send()에서 막힌 송신자와, 락 없이 uart_tx_flush()에서
+ * 막힌 태스크가 동시에 있을 때 인터럽트 give 한 번으로 둘 다 깨어나 끝나는지 본다.
+ * flush 쪽 우선순위를 높여 두 번째 대기자가 give를 받지 못하는 경우를 만든다.
+ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stm32f4xx_ll_dma.h"
+#include "stm32f4xx_ll_usart.h"
+#include "uart_tx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_RING_SIZE 16
+#define TEST_SEND_LEN 200
+#define TEST_TIMEOUT_MS 2000
+
+#define PRIO_DMA (tskIDLE_PRIORITY + 5)
+#define PRIO_MAIN (tskIDLE_PRIORITY + 4)
+#define PRIO_HIGH (tskIDLE_PRIORITY + 3)
+#define PRIO_LOW (tskIDLE_PRIORITY + 2)
+
+DMA_TypeDef test_dma1, test_dma2;
+static USART_TypeDef test_usart;
+static uint8_t test_ring[TEST_RING_SIZE];
+
+static uart_tx_t test_tx = {
+    .uart = &test_usart,
+    .dma = &test_dma1,
+    .stream = LL_DMA_STREAM_6,
+    .channel = LL_DMA_CHANNEL_4,
+    .irqn = 0,
+    .ring = test_ring,
+    .ring_size = sizeof(test_ring),
+};
+
+static int fail_cnt;
+
+#define CHECK(cond, ...)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);                              \
+      printf(__VA_ARGS__);                                                     \
+      printf("\n");                                                            \
+      fail_cnt++;                                                              \
+    }                                                                          \
+  } while (0)
+
+/* DMA 흉내 */
+static volatile bool dma_hold;
+static uint8_t wire[TEST_SEND_LEN * 4];
+static volatile size_t wire_len;
+
+/* 호출자 */
+static uint8_t send_data[TEST_SEND_LEN];
+static volatile int send_ret = -2;
+static volatile int flush_ret[2] = {-2, -2};
+
+/**
+ * @brief 전송 중인 구간을 "회선"으로 옮기고 TC 인터럽트 처리
+ *
+ * 한 번에 한 구간씩, 1 tick 간격으로 완료시킨다.
+ */
+static void dma_task(void *arg) {
+  (void)arg;
+
+  for (;;) {
+    vTaskDelay(1);
+
+    if (dma_hold || !test_dma1.EN) {
+      continue;
+    }
+
+    size_t len = test_tx.dma_len;
+    if (wire_len + len <= sizeof(wire)) {
+      memcpy(&wire[wire_len], &test_ring[test_tx.tail], len);
+      wire_len += len;
+    }
+
+    test_dma1.EN = 0;
+    test_usart.SR |= USART_SR_TC;
+    test_dma1.HISR = (1u << 5) << 16; // 스트림 6 TC
+    uart_tx_irq_handler(&test_tx);
+    test_dma1.HISR = 0;
+  }
+}
+
+static void send_task(void *arg) {
+  (void)arg;
+  send_ret = uart_tx_send(&test_tx, send_data, sizeof(send_data),
+                          portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+static void flush_task(void *arg) {
+  volatile int *ret = (volatile int *)arg;
+
+  *ret = uart_tx_flush(&test_tx, portMAX_DELAY);
+  vTaskDelete(NULL);
+}
+
+static bool wait_done(volatile int *ret) {
+  for (int i = 0; i < TEST_TIMEOUT_MS; i++) {
+    if (*ret != -2) {
+      return true;
+    }
+    vTaskDelay(pdMS_TO_TICKS(1));
+  }
+  return false;
+}
+
+/**
+ * @brief 링 공간 대기(송신자) + 완료 대기(flush) 동시 블록
+ */
+static void test_send_and_flush(void) {
+  dma_hold = true;
+
+  xTaskCreate(send_task, "send", configMINIMAL_STACK_SIZE, NULL, PRIO_LOW,
+              NULL);
+  vTaskDelay(pdMS_TO_TICKS(10));
+  CHECK(send_ret == -2, "sender should block on a full ring");
+
+  xTaskCreate(flush_task, "flush0", configMINIMAL_STACK_SIZE,
+              (void *)&flush_ret[0], PRIO_HIGH, NULL);
+  vTaskDelay(pdMS_TO_TICKS(10));
+  CHECK(flush_ret[0] == -2, "flush should block while the ring is busy");
+  CHECK(!(xEventGroupGetBits(test_tx.done_evt) & 1u), "done bit not armed");
+
+  dma_hold = false;
+
+  CHECK(wait_done(&send_ret), "blocked sender never woke up");
+  CHECK(send_ret == TEST_SEND_LEN, "send returned %d", send_ret);
+  CHECK(wait_done(&flush_ret[0]), "blocked flush never woke up");
+  CHECK(flush_ret[0] == 0, "flush returned %d", flush_ret[0]);
+
+  // flush는 송신자보다 먼저 링이 빈 순간 끝날 수 있으므로 남은 꼬리를 마저 보냄
+  CHECK(uart_tx_flush(&test_tx, TEST_TIMEOUT_MS) == 0, "final flush failed");
+  CHECK(!uart_tx_is_busy(&test_tx), "ring not drained");
+  CHECK(wire_len == TEST_SEND_LEN, "wire_len=%u", (unsigned)wire_len);
+  CHECK(memcmp(wire, send_data, TEST_SEND_LEN) == 0, "wire data mismatch");
+}
+
+/**
+ * @brief 두 flush 동시 블록
+ */
+static void test_two_flush(void) {
+  static const uint8_t msg[] = "two flushers";
+
+  dma_hold = true;
+  wire_len = 0;
+
+  CHECK(uart_tx_send(&test_tx, msg, sizeof(msg), 0) == (int)sizeof(msg),
+        "send failed");
+
+  flush_ret[0] = -2;
+  flush_ret[1] = -2;
+  xTaskCreate(flush_task, "flush0", configMINIMAL_STACK_SIZE,
+              (void *)&flush_ret[0], PRIO_HIGH, NULL);
+  xTaskCreate(flush_task, "flush1", configMINIMAL_STACK_SIZE,
+              (void *)&flush_ret[1], PRIO_LOW, NULL);
+  vTaskDelay(pdMS_TO_TICKS(10));
+  CHECK(!(xEventGroupGetBits(test_tx.done_evt) & 1u), "done bit not armed");
+
+  dma_hold = false;
+
+  CHECK(wait_done(&flush_ret[0]), "first flush never woke up");
+  CHECK(wait_done(&flush_ret[1]), "second flush never woke up");
+  CHECK(flush_ret[0] == 0 && flush_ret[1] == 0, "flush returned %d/%d",
+        flush_ret[0], flush_ret[1]);
+  CHECK(wire_len == sizeof(msg), "wire_len=%u", (unsigned)wire_len);
+}
+
+static void main_task(void *arg) {
+  (void)arg;
+
+  for (size_t i = 0; i < sizeof(send_data); i++) {
+    send_data[i] = (uint8_t)(i * 7 + 1);
+  }
+
+  CHECK(uart_tx_init(&test_tx) == 0, "uart_tx_init failed");
+
+  test_send_and_flush();
+  test_two_flush();
+
+  if (fail_cnt) {
+    printf("test_uart_tx: %d failure(s)\n", fail_cnt);
+    exit(1);
+  }
+
+  printf("test_uart_tx: OK\n");
+  exit(0);
+}
+
+int main(void) {
+  xTaskCreate(dma_task, "dma", configMINIMAL_STACK_SIZE, NULL, PRIO_DMA, NULL);
+  xTaskCreate(main_task, "main", configMINIMAL_STACK_SIZE, NULL, PRIO_MAIN,
+              NULL);
+  vTaskStartScheduler();
+  return 1;
+}
+
+void vApplicationMallocFailedHook(void) {
+  fprintf(stderr, "malloc failed\n");
+  abort();
+}
+
+void vAssertCalled(const char *file, int line) {
+  fprintf(stderr, "ASSERT %s:%d\n", file, line);
+  abort();
+}
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+"""토큰화 로그(LOG_TOKENIZED) 디코더
+
+펌웨어를 -DLOG_TOKENIZED 로 빌드하면 LOG_* 는 문자열 대신
+  0xA5 | len | id(LE16) | tick(LE32) | 인자...
+프레임만 내보낸다. id 는 ELF log_fmt 섹션 안의 "레벨\\x1fTAG\\x1f포맷" 오프셋이다.
+이 스크립트는 같은 빌드의 ELF 에서 log_fmt 섹션을 읽어 원래 텍스트로 복원한다.
+
+사용 예)
+  python3 tools/log_decode.py Debug/gugu_system_rover.elf rtt_dump.bin
+  nc 10.0.0.5 7000 | python3 tools/log_decode.py gugu.elf -
+
+인자 인코딩 규칙은 lib/log/log.c log_token_put_args() 와 같다:
+  정수 4바이트 (ll/j 는 8), 실수 8바이트 double, %p 4바이트,
+  %s / %B / %H 는 길이 1바이트 + 바이트열
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+SEP = "\x1f"
+
+LEVEL_NAME = {"1": "E", "2": "W", "3": "I", "4": "D"}
+LEVEL_COLOR = {"1": "\033[31m", "2": "\033[33m", "3": "", "4": "\033[32m"}
+COLOR_RESET = "\033[0m"
+
+SPEC_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d+))?"
+    r"(?P<len>hh|h|ll|l|z|j|t|L)?(?P<conv>[diouxXcfFeEgGspnBH%])")
+
+
+def read_log_fmt_section(path):
+    """ELF(32/64, little endian)에서 log_fmt 섹션 내용을 읽는다."""
+    with open(path, "rb") as f:
+        elf = f.read()
+
+    if elf[:4] != b"\x7fELF":
+        raise ValueError("ELF 파일이 아님: %s" % path)
+    if elf[5] != 1:
+        raise ValueError("little endian ELF만 지원")
+
+    is64 = elf[4] == 2
+    if is64:
+        shoff, = struct.unpack_from("<Q", elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x3A)
+    else:
+        shoff, = struct.unpack_from("<I", elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", elf, 0x2E)
+
+    def section(idx):
+        base = shoff + idx * shentsize
+        if is64:
+            name, _type, _flags, _addr, off, size = struct.unpack_from(
+                "<IIQQQQ", elf, base)
+        else:
+            name, _type, _flags, _addr, off, size = struct.unpack_from(
+                "<IIIIII", elf, base)
+        return name, off, size
+
+    _, str_off, _ = section(shstrndx)
+    for i in range(shnum):
+        name, off, size = section(i)
+        end = elf.index(b"\0", str_off + name)
+        if elf[str_off + name:end] == b"log_fmt":
+            return elf[off:off + size]
+
+    raise ValueError("log_fmt 섹션 없음 (LOG_TOKENIZED 빌드인지 확인)")
+
+
+class Entry:
+    def __init__(self, level, tag, fmt):
+        self.level = level
+        self.tag = tag
+        self.fmt = fmt
+
+
+def load_entries(section):
+    """오프셋 -> Entry (문자열 시작 위치마다)"""
+    entries = {}
+    pos = 0
+    while pos < len(section):
+        end = section.find(b"\0", pos)
+        if end < 0:
+            break
+        raw = section[pos:end].decode("utf-8", errors="replace")
+        parts = raw.split(SEP, 2)
+        if len(parts) == 3 and parts[0] in LEVEL_NAME:
+            entries[pos] = Entry(parts[0], parts[1], parts[2])
+        pos = end + 1
+        # 섹션 안 문자열 사이 정렬 패딩 건너뜀
+        while pos < len(section) and section[pos] == 0:
+            pos += 1
+    return entries
+
+
+class ArgReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def uint(self, size):
+        if self.pos + size > len(self.data):
+            raise ValueError("인자 부족")
+        v = int.from_bytes(self.data[self.pos:self.pos + size], "little")
+        self.pos += size
+        return v
+
+    def bytes(self):
+        n = self.uint(1)
+        if self.pos + n > len(self.data):
+            raise ValueError("인자 부족")
+        b = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return b
+
+
+def to_signed(v, bits):
+    return v - (1 << bits) if v & (1 << (bits - 1)) else v
+
+
+def escape_raw(data):
+    out = []
+    for c in data:
+        if 0x20 <= c < 0x7F or c in (0x0D, 0x0A):
+            out.append(chr(c))
+        else:
+            out.append("<%02X>" % c)
+    return "".join(out)
+
+
+def render(fmt, args):
+    """C printf 포맷을 토큰 인자로 채운다."""
+    reader = ArgReader(args)
+
+    def repl(m):
+        conv = m.group("conv")
+        if conv == "%":
+            return "%"
+
+        width = m.group("width") or ""
+        prec = m.group("prec")
+        if width == "*":
+            width = str(to_signed(reader.uint(4), 32))
+        if prec == "*":
+            prec = str(to_signed(reader.uint(4), 32))
+        spec = "%" + m.group("flags") + width + ("." + prec if prec else "")
+
+        ln = m.group("len") or ""
+        size = 8 if ln in ("ll", "j") else 4
+
+        if conv in "di":
+            return (spec + "d") % to_signed(reader.uint(size), size * 8)
+        if conv in "uoxX":
+            return (spec + ("d" if conv == "u" else conv)) % reader.uint(size)
+        if conv == "c":
+            return (spec + "c") % chr(reader.uint(4) & 0xFF)
+        if conv in "fFeEgG":
+            return (spec + conv) % struct.unpack("<d", struct.pack(
+                "<Q", reader.uint(8)))[0]
+        if conv == "s":
+            return (spec + "s") % reader.bytes().decode("utf-8",
+                                                        errors="replace")
+        if conv == "p":
+            return "0x%08x" % reader.uint(4)
+        if conv == "B":
+            return escape_raw(reader.bytes())
+        if conv == "H":
+            return "".join(" %02X" % c for c in reader.bytes())
+        return ""  # %n
+
+    try:
+        return SPEC_RE.sub(repl, fmt)
+    except (ValueError, struct.error) as e:
+        return fmt + "  <decode error: %s>" % e
+
+
+def decode_stream(stream, entries, out, color=True):
+    buf = bytearray()
+    stats = {"frames": 0, "skipped": 0}
+    # 파이프/시리얼은 read1으로 받은 만큼 바로 처리
+    read = getattr(stream, "read1", stream.read)
+
+    while True:
+        chunk = read(4096)
+        if chunk:
+            buf += chunk
+
+        while len(buf) >= 2:
+            if buf[0] != SYNC:
+                del buf[0]
+                stats["skipped"] += 1
+                continue
+
+            flen = buf[1]
+            if flen < 6:
+                del buf[0]
+                stats["skipped"] += 1
+                continue
+            if len(buf) < 2 + flen:
+                break
+
+            frame = bytes(buf[2:2 + flen])
+            fid, tick = struct.unpack_from("<HI", frame, 0)
+            entry = entries.get(fid)
+            if entry is None:
+                # 잘못된 sync: 한 바이트 밀어서 다시 찾음
+                del buf[0]
+                stats["skipped"] += 1
+                continue
+
+            del buf[:2 + flen]
+            stats["frames"] += 1
+
+            text = render(entry.fmt, frame[6:])
+            if entry.tag == "LOG" and entry.fmt in ("%B", "%H"):
+                # LOG_DEBUG_RAW/HEX 이어지는 프레임
+                out.write(text + "\n")
+                continue
+
+            pre = LEVEL_COLOR[entry.level] if color else ""
+            post = COLOR_RESET if (color and pre) else ""
+            out.write("%s[%u][%s][%s]%s%s\n" % (pre, tick,
+                                                LEVEL_NAME[entry.level],
+                                                entry.tag, text, post))
+
+        if not chunk:
+            break
+
+    return stats
+
+
+def main():
+    ap = argparse.ArgumentParser(description="토큰화 로그 디코더")
+    ap.add_argument("elf", help="같은 빌드의 ELF (log_fmt 섹션 포함)")
+    ap.add_argument("input", nargs="?", default="-",
+                    help="로그 바이너리 (기본: stdin)")
+    ap.add_argument("--no-color", action="store_true", help="ANSI 색상 끔")
+    ap.add_argument("--list", action="store_true",
+                    help="ID -> 포맷 문자열 표만 출력")
+    args = ap.parse_args()
+
+    entries = load_entries(read_log_fmt_section(args.elf))
+
+    if args.list:
+        for fid in sorted(entries):
+            e = entries[fid]
+            fmt = e.fmt.replace("\r", "\\r").replace("\n", "\\n")
+            print("%5u  %s  %-8s %s" % (fid, LEVEL_NAME[e.level], e.tag, fmt))
+        return 0
+
+    stream = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    try:
+        stats = decode_stream(stream, entries, sys.stdout,
+                              color=not args.no_color)
+    finally:
+        if stream is not sys.stdin.buffer:
+            stream.close()
+
+    if stats["skipped"]:
+        sys.stderr.write("resync: %u bytes skipped\n" % stats["skipped"])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
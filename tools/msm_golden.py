@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+"""MSM7 -> MSM4 고정 기준 벡터 생성기 (test/test_rtcm_msm.c golden_*)
+
+관측값(의사거리 [m], 반송파 [cycle], 잠금 시간 [ms], C/N0 [dBHz])에서
+RTKLIB rtcm3e.c 방식으로 1077을 만들고, 그 1077을 RTKLIB rtcm3.c
+decode_msm7()처럼 물리량으로 풀어 다시 RTKLIB 방식으로 1074를 인코딩한다.
+C 변환기(정수 비트 연산)와 테스트 안의 기준 인코더(분해능 정수)와는
+거리/위상을 미터와 파장을 거쳐 다시 계산한다는 점이 다르다.
+
+잠금 시간은 수신 이력이 없으므로 DF407 표 값을 그대로 DF402로 옮긴다
+(RTKLIB 인코더는 자체 LLI 이력으로 잠금 시간을 다시 세므로 이 부분은 다를 수 있음).
+
+1077 -> 1074 경로는 유리수(Fraction)로 계산해 부동소수점 오차 없이
+ROUND(x) = floor(x + 1/2)를 그대로 적용한다. 분해능이 2^5, 2^2배 거칠어지므로
+.5 경계는 실제 데이터에서도 흔하다 (double 경로에서는 오차 방향에 따라 갈림).
+관측값 -> 1077 경로는 RTKLIB처럼 double로 계산하되 .5 경계 값은 거부한다.
+
+사용 예)
+  python3 tools/msm_golden.py > /tmp/golden.h
+"""
+
+import math
+from fractions import Fraction
+
+CLIGHT = 299792458.0
+RANGE_MS = CLIGHT * 0.001
+FREQ_L1 = 1.57542e9
+FREQ_L2 = 1.22760e9
+P2_10 = 2.0 ** -10
+P2_24 = 2.0 ** -24
+P2_29 = 2.0 ** -29
+P2_31 = 2.0 ** -31
+
+STATION = 2003
+EPOCH_MS = 345600000 + 12 * 3600000 + 7000  # GPS TOW [ms]
+
+# 신호 ID (RTCM DF395 비트 번호): 2 = L1 C/A (1C), 9 = L2 P(Y) (2W)
+SIGNALS = [(2, CLIGHT / FREQ_L1), (9, CLIGHT / FREQ_L2)]
+
+# PRN: [(pr [m], cp [cycle], lock [ms], cnr [dBHz], doppler [Hz]) 또는 None] x 신호
+OBS = {
+    5: [(21487635.271, 112918213.433, 942000, 47.3125, -1834.277),
+        (21487639.642, 87988230.117, 942000, 41.0625, -1429.305)],
+    13: [(23716245.918, 124630219.581, 318500, 41.8750, 2987.616),
+         None],
+    15: [(20318902.404, 106776553.749, 1520000, 50.1875, -412.839),
+         (20318907.155, 83202524.301, 1520000, 44.8125, -321.692)],
+    24: [(24987311.063, 131311942.860, 72000, 36.4375, 3511.205),
+         (24987316.902, 0.0, 0, 29.5625, 2736.091)],
+    30: [(22104577.539, 116161734.197, 2560, 44.6250, 1203.448),
+         (22104582.716, 90515646.953, 2560, 38.1875, 937.776)],
+}
+
+LOCK_EX_TBL = [
+    (63, 1, 0), (95, 2, 64), (127, 4, 256), (159, 8, 768), (191, 16, 2048),
+    (223, 32, 5120), (255, 64, 12288), (287, 128, 28672), (319, 256, 65536),
+    (351, 512, 147456), (383, 1024, 327680), (415, 2048, 720896),
+    (447, 4096, 1572864), (479, 8192, 3407872), (511, 16384, 7340032),
+    (543, 32768, 15728640), (575, 65536, 33554432), (607, 131072, 71303168),
+    (639, 262144, 150994944), (671, 524288, 318767104),
+    (703, 1048576, 671088640),
+]
+
+
+def rnd(x):
+    """RTKLIB ROUND(): floor(x + 0.5), .5 경계는 거부"""
+    if abs((x - math.floor(x)) - 0.5) < 1e-6:
+        raise ValueError("rounding tie: %r" % x)
+    return int(math.floor(x + 0.5))
+
+
+def rnd_exact(x):
+    """유리수 ROUND(): floor(x + 1/2)"""
+    return math.floor(x + Fraction(1, 2))
+
+
+# 1077 -> 1074 경로용 정확한 상수
+Q_RANGE_MS = Fraction(299792458, 1000)
+Q_LAM = {2: Fraction(299792458, 1575420000), 9: Fraction(299792458, 1227600000)}
+
+
+def to_msm_lock_ex(lock_ms):
+    """잠금 시간 [ms] -> DF407 (RTKLIB to_msm_lock_ex)"""
+    lock = int(lock_ms)
+    if lock < 0:
+        return 0
+    if lock < 64:
+        return lock
+    if lock < 128:
+        return (lock + 64) // 2
+    if lock < 256:
+        return (lock + 256) // 4
+    if lock < 512:
+        return (lock + 768) // 8
+    if lock < 1024:
+        return (lock + 2048) // 16
+    if lock < 2048:
+        return (lock + 5120) // 32
+    if lock < 4096:
+        return (lock + 12288) // 64
+    if lock < 8192:
+        return (lock + 28672) // 128
+    if lock < 16384:
+        return (lock + 65536) // 256
+    if lock < 32768:
+        return (lock + 147456) // 512
+    if lock < 65536:
+        return (lock + 327680) // 1024
+    if lock < 131072:
+        return (lock + 720896) // 2048
+    if lock < 262144:
+        return (lock + 1572864) // 4096
+    if lock < 524288:
+        return (lock + 3407872) // 8192
+    if lock < 1048576:
+        return (lock + 7340032) // 16384
+    if lock < 2097152:
+        return (lock + 15728640) // 32768
+    if lock < 4194304:
+        return (lock + 33554432) // 65536
+    if lock < 8388608:
+        return (lock + 71303168) // 131072
+    if lock < 16777216:
+        return (lock + 150994944) // 262144
+    if lock < 33554432:
+        return (lock + 318767104) // 524288
+    if lock < 67108864:
+        return (lock + 671088640) // 1048576
+    return 704
+
+
+def msm_lock_ex_ms(ind):
+    """DF407 -> 잠금 시간 [ms] (RTKLIB rtcm3.c msm_lock_ex 역)"""
+    for top, mul, sub in LOCK_EX_TBL:
+        if ind <= top:
+            return mul * ind - sub
+    return 67108864
+
+
+def to_msm_lock(lock_s):
+    """잠금 시간 [s] -> DF402 (RTKLIB to_msm_lock)"""
+    for i, lim in enumerate([0.032, 0.064, 0.128, 0.256, 0.512, 1.024, 2.048,
+                             4.096, 8.192, 16.384, 32.768, 65.536, 131.072,
+                             262.144, 524.288]):
+        if lock_s < lim:
+            return i
+    return 15
+
+
+class Bits:
+    def __init__(self):
+        self.bits = []
+
+    def u(self, n, v):
+        assert 0 <= v < (1 << n), (n, v)
+        self.bits += [(v >> (n - 1 - i)) & 1 for i in range(n)]
+
+    def s(self, n, v):
+        assert -(1 << (n - 1)) <= v < (1 << (n - 1)), (n, v)
+        self.u(n, v & ((1 << n) - 1))
+
+    def frame(self):
+        b = self.bits + [0] * (-len(self.bits) % 8)
+        payload = bytes(int("".join(map(str, b[i:i + 8])), 2)
+                        for i in range(0, len(b), 8))
+        head = bytes([0xD3, len(payload) >> 8, len(payload) & 0xFF])
+        crc = crc24q(head + payload)
+        return head + payload + bytes([crc >> 16, (crc >> 8) & 0xFF, crc & 0xFF])
+
+
+class Reader:
+    def __init__(self, frame):
+        n = (frame[1] << 8 | frame[2]) & 0x3FF
+        assert crc24q(frame[:3 + n]) == int.from_bytes(frame[3 + n:6 + n], "big")
+        self.bits = "".join("{:08b}".format(x) for x in frame[3:3 + n])
+        self.pos = 0
+
+    def u(self, n):
+        v = int(self.bits[self.pos:self.pos + n], 2)
+        self.pos += n
+        return v
+
+    def s(self, n):
+        v = self.u(n)
+        return v - (1 << n) if v & (1 << (n - 1)) else v
+
+
+def crc24q(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte << 16
+        for _ in range(8):
+            crc <<= 1
+            if crc & 0x1000000:
+                crc ^= 0x1864CFB
+    return crc & 0xFFFFFF
+
+
+def header(w, mtype, sats, cells):
+    w.u(12, mtype)
+    w.u(12, STATION)
+    w.u(30, EPOCH_MS)
+    w.u(1, 0)   # multiple message
+    w.u(3, 0)   # IODS
+    w.u(7, 0)   # reserved
+    w.u(2, 0)   # clock steering
+    w.u(2, 0)   # external clock
+    w.u(1, 0)   # smoothing
+    w.u(3, 0)   # smoothing interval
+    for prn in range(1, 65):
+        w.u(1, 1 if prn in sats else 0)
+    for sig in range(1, 33):
+        w.u(1, 1 if sig in [s for s, _ in SIGNALS] else 0)
+    for c in cells:
+        w.u(1, 1 if c else 0)
+
+
+def encode_1077():
+    sats = sorted(OBS)
+    cells = [OBS[p][j] is not None for p in sats for j in range(len(SIGNALS))]
+    rrng, rrate = {}, {}
+
+    for p in sats:
+        first = next(o for o in OBS[p] if o is not None)
+        rrng[p] = rnd(first[0] / RANGE_MS / P2_10) * RANGE_MS * P2_10
+        rrate[p] = rnd(-first[4] * SIGNALS[0][1])
+
+    w = Bits()
+    header(w, 1077, sats, cells)
+    for p in sats:
+        w.u(8, int(math.floor(rrng[p] / RANGE_MS)))
+    for p in sats:
+        w.u(4, 0)
+    for p in sats:
+        w.u(10, rnd((rrng[p] / RANGE_MS - math.floor(rrng[p] / RANGE_MS)) / P2_10))
+    for p in sats:
+        w.s(14, rrate[p])
+
+    cell = [(p, j, OBS[p][j]) for p in sats for j in range(len(SIGNALS))
+            if OBS[p][j] is not None]
+    for p, j, o in cell:
+        ps = o[0] - rrng[p]
+        w.s(20, -524288 if abs(ps) > 292.7 else rnd(ps / RANGE_MS / P2_29))
+    for p, j, o in cell:
+        ph = o[1] * SIGNALS[j][1] - rrng[p]
+        w.s(24, -8388608 if o[1] == 0.0 or abs(ph) > 1171.0
+            else rnd(ph / RANGE_MS / P2_31))
+    for p, j, o in cell:
+        w.u(10, to_msm_lock_ex(o[2]))
+    for p, j, o in cell:
+        w.u(1, 0)
+    for p, j, o in cell:
+        w.u(10, rnd(o[3] / 0.0625))
+    for p, j, o in cell:
+        rr = -o[4] * SIGNALS[j][1] - rrate[p]
+        w.s(15, rnd(rr / 0.0001))
+
+    return w.frame()
+
+
+def decode_1077(frame):
+    """RTKLIB decode_msm7(): 프레임 -> 위성별 대략 거리 [m] 및 셀 관측값"""
+    r = Reader(frame)
+    mtype = r.u(12)
+    assert mtype == 1077
+    r.u(12 + 30 + 1 + 3 + 7 + 2 + 2 + 1 + 3)
+    sats = [prn for prn in range(1, 65) if r.u(1)]
+    sigs = [sig for sig in range(1, 33) if r.u(1)]
+    cells = [(p, s) for p in sats for s in sigs if r.u(1)]
+    rint = [r.u(8) for _ in sats]
+    [r.u(4) for _ in sats]
+    rmod = [r.u(10) for _ in sats]
+    [r.s(14) for _ in sats]
+    rrng = {p: (rint[i] + Fraction(rmod[i], 1 << 10)) * Q_RANGE_MS
+            for i, p in enumerate(sats)}
+
+    pr = [r.s(20) for _ in cells]
+    cp = [r.s(24) for _ in cells]
+    lock = [r.u(10) for _ in cells]
+    half = [r.u(1) for _ in cells]
+    cnr = [r.u(10) for _ in cells]
+
+    obs = []
+    for k, (p, s) in enumerate(cells):
+        P = None if pr[k] == -524288 else rrng[p] + Fraction(pr[k], 1 << 29) * Q_RANGE_MS
+        L = None if cp[k] == -8388608 else (rrng[p] + Fraction(cp[k], 1 << 31) * Q_RANGE_MS) / Q_LAM[s]
+        obs.append((p, s, P, L, msm_lock_ex_ms(lock[k]), half[k], Fraction(cnr[k], 16)))
+    return sats, sigs, cells, rint, rmod, obs
+
+
+def encode_1074(decoded):
+    """RTKLIB encode_msm4() 방식, 대략 거리는 1077 값을 그대로 사용"""
+    sats, sigs, cells, rint, rmod, obs = decoded
+    rrng = {p: (rint[i] + Fraction(rmod[i], 1 << 10)) * Q_RANGE_MS
+            for i, p in enumerate(sats)}
+
+    w = Bits()
+    header(w, 1074, sats, [(p, s) in cells for p in sats for s in sigs])
+    for v in rint:
+        w.u(8, v)
+    for v in rmod:
+        w.u(10, v)
+    for p, s, P, L, lk, hf, cn in obs:
+        ps = P - rrng[p]
+        if P is None:
+            w.s(15, -16384)
+            continue
+        v = rnd_exact((P - rrng[p]) / Q_RANGE_MS * (1 << 24))
+        w.s(15, v if -16384 < v < 16384 else -16384)
+    for p, s, P, L, lk, hf, cn in obs:
+        if L is None:
+            w.s(22, -2097152)
+            continue
+        v = rnd_exact((L * Q_LAM[s] - rrng[p]) / Q_RANGE_MS * (1 << 29))
+        w.s(22, v if -2097152 < v < 2097152 else -2097152)
+    for p, s, P, L, lk, hf, cn in obs:
+        w.u(4, to_msm_lock(lk / 1000.0))
+    for p, s, P, L, lk, hf, cn in obs:
+        w.u(1, hf)
+    for p, s, P, L, lk, hf, cn in obs:
+        w.u(6, min(63, rnd_exact(cn)))
+    return w.frame()
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 12):
+        lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 12]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    msm7 = encode_1077()
+    msm4 = encode_1074(decode_1077(msm7))
+    print(c_array("golden_1077", msm7))
+    print()
+    print(c_array("golden_1074", msm4))
+
+
+if __name__ == "__main__":
+    main()